@@ -89,6 +89,30 @@ void CommandList::removeMemoryPrefetchAllocations() {
     }
 }
 
+void CommandList::insertSharedKernelAllocationsForPrefetch(const std::vector<NEO::GraphicsAllocation *> &kernelAllocations) {
+    if (NEO::debugManager.flags.PrefetchSharedKernelArguments.get() != 1 || isImmediateType()) {
+        return;
+    }
+    auto memoryManager = this->device->getDriverHandle()->getMemoryManager();
+    auto prefetchManager = memoryManager->getPrefetchManager();
+    if (!prefetchManager || !memoryManager->isKmdMigrationAvailable(this->device->getRootDeviceIndex())) {
+        return;
+    }
+
+    auto svmAllocsManager = this->device->getDriverHandle()->getSvmAllocsManager();
+    for (auto allocation : kernelAllocations) {
+        if (allocation == nullptr || allocation->getAllocationType() != NEO::AllocationType::unifiedSharedMemory) {
+            continue;
+        }
+        auto usmPtr = allocation->getUnderlyingBuffer();
+        auto allocData = svmAllocsManager->getSVMAlloc(usmPtr);
+        if (allocData) {
+            prefetchManager->insertAllocation(this->prefetchContext, usmPtr, *allocData);
+            this->performMemoryPrefetch = true;
+        }
+    }
+}
+
 void CommandList::registerCsrDcFlushForDcMitigation(NEO::CommandStreamReceiver &csr) {
     if (this->requiresDcFlushForDcMitigation) {
         csr.registerDcFlushForDcMitigation();
@@ -179,6 +179,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t destroy() override;
+    ze_result_t reset() override;
+
     MOCKABLE_VIRTUAL ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission);
     ze_result_t executeCommandListImmediateWithFlushTaskImpl(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, CommandQueue *cmdQ);
     ze_result_t appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
@@ -197,6 +200,11 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent);
+    bool isDeferredFlushAllowed(bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent) const;
+    ze_result_t flushDeferredAppends();
+    uint32_t getDeferredAppendsCount() const { return deferredAppendsCount; }
+    uint64_t getBatchedSubmissionsCount() const { return batchedSubmissionsCount; }
+    uint64_t getSavedSubmissionsCount() const { return savedSubmissionsCount; }
 
     bool preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     bool isSuitableUSMHostAlloc(NEO::SvmAllocationData *alloc);
@@ -227,6 +235,11 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     std::atomic<bool> dependenciesPresent{false};
     bool latestFlushIsHostVisible = false;
     bool latestFlushIsCopyOffload = false;
+
+    uint64_t batchedSubmissionsCount = 0;
+    uint64_t savedSubmissionsCount = 0;
+    uint32_t deferredAppendsCount = 0;
+    bool deferredAppendsKernelOperation = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
@@ -56,6 +56,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
        If relaxed ordering is needed in given dispatch and current command stream is in system memory, swap of command streams is required to ensure local memory. Same in the opposite scenario. */
     if (hasRelaxedOrderingDependencies == NEO::MemoryPoolHelper::isSystemMemoryPool(this->commandContainer.getCommandStream()->getGraphicsAllocation()->getMemoryPool())) {
+        flushDeferredAppends();
         if (this->commandContainer.swapStreams()) {
             this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
         }
@@ -63,6 +64,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
 
     size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + semaphoreSize) {
+        flushDeferredAppends();
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies;
 
         auto alloc = this->commandContainer.reuseExistingCmdBuffer(requireSystemMemoryCommandBuffer);
@@ -447,6 +449,10 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
 
     ze_result_t status = ZE_RESULT_SUCCESS;
 
+    if (cmdQ == this->cmdQImmediate) {
+        this->commandContainer.storeAllocationsPendingSubmission(completionStamp.taskCount);
+    }
+
     if (cmdQ == this->cmdQImmediate || cmdQ == this->cmdQImmediateCopyOffload) {
         cmdQ->setTaskCount(completionStamp.taskCount);
 
@@ -938,7 +944,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(v
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, bool handlePostWaitOperations) {
-    ze_result_t status = ZE_RESULT_SUCCESS;
+    ze_result_t status = flushDeferredAppends();
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
 
     auto waitQueue = this->cmdQImmediate;
 
@@ -1035,9 +1044,32 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     auto signalEvent = Event::fromHandle(hSignalEvent);
 
     auto queue = copyOffloadSubmission ? this->cmdQImmediateCopyOffload : this->cmdQImmediate;
+
+    if (inputRet == ZE_RESULT_SUCCESS && isDeferredFlushAllowed(hasStallingCmds, hasRelaxedOrderingDependencies, copyOffloadSubmission, hSignalEvent)) {
+        this->deferredAppendsCount++;
+        this->deferredAppendsKernelOperation |= kernelOperation;
+        this->commandContainer.setImmediateCmdListSubmissionDeferred(true);
+        return inputRet;
+    }
+
+    if (copyOffloadSubmission) {
+        auto flushStatus = flushDeferredAppends();
+        if (flushStatus != ZE_RESULT_SUCCESS) {
+            return flushStatus;
+        }
+    }
+
     this->latestFlushIsCopyOffload = copyOffloadSubmission;
 
     if (inputRet == ZE_RESULT_SUCCESS) {
+        if (this->deferredAppendsCount > 0) {
+            kernelOperation |= this->deferredAppendsKernelOperation;
+            this->batchedSubmissionsCount++;
+            this->savedSubmissionsCount += this->deferredAppendsCount;
+            this->deferredAppendsCount = 0;
+            this->deferredAppendsKernelOperation = false;
+            this->commandContainer.setImmediateCmdListSubmissionDeferred(false);
+        }
         if (this->isFlushTaskSubmissionEnabled) {
             if (signalEvent && (NEO::debugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0)) {
                 signalEvent->setLatestUsedCmdQueue(queue);
@@ -1058,6 +1090,66 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     return inputRet;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isDeferredFlushAllowed(bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent) const {
+    auto maxDeferredAppends = NEO::debugManager.flags.ImmediateCmdListDeferredFlushThreshold.get();
+    if (maxDeferredAppends <= 0 || this->deferredAppendsCount + 1 >= static_cast<uint32_t>(maxDeferredAppends)) {
+        return false;
+    }
+
+    // appends that need to be observable by host or other queues are flushed together with all deferred ones
+    if (hSignalEvent != nullptr || hasStallingCmds || hasRelaxedOrderingDependencies || copyOffloadSubmission) {
+        return false;
+    }
+
+    if (!this->isFlushTaskSubmissionEnabled || this->isSyncModeQueue || isInOrderExecutionEnabled() || isCopyOnly() || this->kernelWithAssertAppended) {
+        return false;
+    }
+
+    // heap replaced during the batch is reused only after the batch is submitted
+    if (this->commandContainer.hasAllocationsPendingSubmission()) {
+        return false;
+    }
+
+    // state changes between deferred appends have to be programmed inline in the command list
+    bool stateTrackedInCmdList = this->frontEndStateTracking && this->pipelineSelectStateTracking && this->stateComputeModeTracking;
+    bool heapsTrackedInCmdList = this->heaplessModeEnabled || (this->stateBaseAddressTracking && !this->immediateCmdListHeapSharing);
+
+    return stateTrackedInCmdList && heapsTrackedInCmdList;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushDeferredAppends() {
+    if (this->deferredAppendsCount == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    this->batchedSubmissionsCount++;
+    this->savedSubmissionsCount += this->deferredAppendsCount - 1;
+    auto kernelOperation = this->deferredAppendsKernelOperation;
+    this->deferredAppendsCount = 0;
+    this->deferredAppendsKernelOperation = false;
+    this->latestFlushIsCopyOffload = false;
+    this->commandContainer.setImmediateCmdListSubmissionDeferred(false);
+
+    return executeCommandListImmediateWithFlushTask(true, false, false, kernelOperation, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    flushDeferredAppends();
+    return BaseClass::destroy();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::reset() {
+    auto status = flushDeferredAppends();
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
+    return BaseClass::reset();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(CpuMemCopyInfo &cpuMemCopyInfo, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     if (NEO::debugManager.flags.ExperimentalForceCopyThroughLock.get() == 1) {
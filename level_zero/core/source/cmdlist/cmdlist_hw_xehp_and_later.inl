@@ -439,6 +439,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
             for (auto resource : residencyContainer) {
                 commandContainer.addToResidencyContainer(resource);
             }
+            insertSharedKernelAllocationsForPrefetch(residencyContainer);
         }
     }
 
@@ -1644,6 +1644,10 @@ NEO::GraphicsAllocation *DeviceImp::obtainReusableAllocation(size_t requiredSize
 
 void DeviceImp::storeReusableAllocation(NEO::GraphicsAllocation &alloc) {
     allocationsForReuse->pushFrontOne(alloc);
+    if (NEO::debugManager.flags.ReusableCommandBufferPoolMaxSize.get() != -1) {
+        allocationsForReuse->trimToSize(static_cast<size_t>(NEO::debugManager.flags.ReusableCommandBufferPoolMaxSize.get()) * MemoryConstants::kiloByte,
+                                        neoDevice->getMemoryManager());
+    }
 }
 
 bool DeviceImp::isQueueGroupOrdinalValid(uint32_t ordinal) {
@@ -211,10 +211,12 @@ struct Event : _ze_event_handle_t {
         if (this->isCompleted.load() != HOST_CACHING_DISABLED_PERMANENT) {
             this->isCompleted.store(STATE_CLEARED);
         }
+        this->signaledPacketsCount.store(0u);
     }
 
     void disableHostCaching(bool disableFromRegularList) {
         this->isCompleted.store(disableFromRegularList ? HOST_CACHING_DISABLED_PERMANENT : HOST_CACHING_DISABLED);
+        this->signaledPacketsCount.store(0u);
     }
 
     void setIsCompleted();
@@ -349,6 +351,9 @@ struct Event : _ze_event_handle_t {
     int index = 0;
 
     std::atomic<State> isCompleted{STATE_INITIAL};
+    // Number of leading packets already observed as signaled while host caching is enabled.
+    // Lets repeated status queries skip packets that cannot go back to cleared without a reset.
+    std::atomic<uint32_t> signaledPacketsCount{0u};
 
     bool isTimestampEvent = false;
     bool usingContextEndOffset = false;
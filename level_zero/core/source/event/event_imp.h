@@ -65,6 +65,11 @@ struct EventImp : public Event {
 
     ze_result_t calculateProfilingData();
     ze_result_t queryStatusEventPackets();
+    void storeSignaledPacketsCount(uint32_t packets, bool packetsCachingAllowed) {
+        if (packetsCachingAllowed && this->isCompleted.load() == STATE_CLEARED) {
+            this->signaledPacketsCount.store(packets);
+        }
+    }
     ze_result_t queryCounterBasedEventStatus();
     void handleSuccessfulHostSynchronization();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
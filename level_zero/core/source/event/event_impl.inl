@@ -275,9 +275,14 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
     assignKernelEventCompletionData(this->hostAddress);
     uint32_t queryVal = Event::STATE_CLEARED;
     uint32_t packets = 0;
+    const bool packetsCachingAllowed = (this->isCompleted.load() == STATE_CLEARED);
+    const uint32_t alreadySignaledPackets = packetsCachingAllowed ? this->signaledPacketsCount.load() : 0u;
     for (uint32_t i = 0; i < this->kernelCount; i++) {
         uint32_t packetsToCheck = kernelEventCompletionData[i].getPacketsUsed();
         for (uint32_t packetId = 0; packetId < packetsToCheck; packetId++, packets++) {
+            if (packets < alreadySignaledPackets) {
+                continue;
+            }
             void const *queryAddress = isUsingContextEndOffset()
                                            ? kernelEventCompletionData[i].getContextEndAddress(packetId)
                                            : kernelEventCompletionData[i].getContextStartAddress(packetId);
@@ -286,6 +291,7 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
                 queryVal,
                 std::not_equal_to<TagSizeT>());
             if (!ready) {
+                storeSignaledPacketsCount(packets, packetsCachingAllowed);
                 return ZE_RESULT_NOT_READY;
             }
         }
@@ -295,13 +301,15 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             uint32_t remainingPackets = getMaxPacketsCount() - packets;
             auto remainingPacketSyncAddress = ptrOffset(this->hostAddress, packets * this->singlePacketSize);
             remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->getCompletionFieldOffset());
-            for (uint32_t i = 0; i < remainingPackets; i++) {
+            for (uint32_t i = 0; i < remainingPackets; i++, packets++) {
                 void const *queryAddress = remainingPacketSyncAddress;
-                bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
-                    static_cast<TagSizeT const *>(queryAddress),
-                    queryVal,
-                    std::not_equal_to<TagSizeT>());
+                bool ready = (packets < alreadySignaledPackets) ||
+                             NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
+                                 static_cast<TagSizeT const *>(queryAddress),
+                                 queryVal,
+                                 std::not_equal_to<TagSizeT>());
                 if (!ready) {
+                    storeSignaledPacketsCount(packets, packetsCachingAllowed);
                     return ZE_RESULT_NOT_READY;
                 }
                 remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->singlePacketSize);
@@ -883,6 +891,7 @@ void EventImp<TagSizeT>::resetKernelCountAndPacketUsedCount() {
         this->kernelEventCompletionData[i].setPacketsUsed(1);
     }
     this->kernelCount = 1;
+    this->signaledPacketsCount.store(0u);
 }
 
 template <typename TagSizeT>
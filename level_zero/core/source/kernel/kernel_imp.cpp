@@ -436,18 +436,17 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     uint32_t dim = (globalSizeY > 1U) ? 2 : 1U;
     dim = (globalSizeZ > 1U) ? 3 : dim;
 
-    auto cachedGroupSize = std::find_if(this->suggestGroupSizeCache.begin(), this->suggestGroupSizeCache.end(), [&](const auto &other) {
-        return other.groupSize == workItems &&
-               other.slmArgsTotalSize == this->getSlmTotalSize();
-    });
-    if (cachedGroupSize != this->suggestGroupSizeCache.end()) {
-        *groupSizeX = static_cast<uint32_t>(cachedGroupSize->suggestedGroupSize.x);
-        *groupSizeY = static_cast<uint32_t>(cachedGroupSize->suggestedGroupSize.y);
-        *groupSizeZ = static_cast<uint32_t>(cachedGroupSize->suggestedGroupSize.z);
+    const NEO::LocalWorkSizeCacheKey cacheKey{workItems, this->getSlmTotalSize(), dim,
+                                              NEO::debugManager.flags.EnableComputeWorkSizeND.get(), NEO::debugManager.flags.EnableComputeWorkSizeSquared.get()};
+    Vec3<size_t> cachedGroupSize{0, 0, 0};
+    if (this->suggestGroupSizeCache.find(cacheKey, cachedGroupSize)) {
+        *groupSizeX = static_cast<uint32_t>(cachedGroupSize.x);
+        *groupSizeY = static_cast<uint32_t>(cachedGroupSize.y);
+        *groupSizeZ = static_cast<uint32_t>(cachedGroupSize.z);
         return ZE_RESULT_SUCCESS;
     }
 
-    if (NEO::debugManager.flags.EnableComputeWorkSizeND.get()) {
+    if (cacheKey.computeWorkSizeND) {
         auto usesImages = kernelDescriptor.kernelAttributes.flags.usesImages;
         auto neoDevice = module->getDevice()->getNEODevice();
         const auto &deviceInfo = neoDevice->getDeviceInfo();
@@ -469,7 +468,7 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     } else {
         if (1U == dim) {
             NEO::computeWorkgroupSize1D(maxWorkGroupSize, retGroupSize, workItems, simd);
-        } else if (NEO::debugManager.flags.EnableComputeWorkSizeSquared.get() && (2U == dim)) {
+        } else if (cacheKey.computeWorkSizeSquared && (2U == dim)) {
             NEO::computeWorkgroupSizeSquared(maxWorkGroupSize, retGroupSize, workItems, simd, dim);
         } else {
             NEO::computeWorkgroupSize2D(maxWorkGroupSize, retGroupSize, workItems, simd);
@@ -478,7 +477,7 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     *groupSizeX = static_cast<uint32_t>(retGroupSize[0]);
     *groupSizeY = static_cast<uint32_t>(retGroupSize[1]);
     *groupSizeZ = static_cast<uint32_t>(retGroupSize[2]);
-    this->suggestGroupSizeCache.emplace_back(workItems, this->getSlmTotalSize(), retGroupSize);
+    this->suggestGroupSizeCache.insert(cacheKey, retGroupSize);
 
     return ZE_RESULT_SUCCESS;
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/helpers/local_work_size_cache.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -255,14 +256,7 @@ struct KernelImp : Kernel {
 
     std::unique_ptr<KernelExt> pExtension;
 
-    struct SuggestGroupSizeCacheEntry {
-        Vec3<size_t> groupSize;
-        uint32_t slmArgsTotalSize = 0u;
-
-        Vec3<size_t> suggestedGroupSize;
-        SuggestGroupSizeCacheEntry(size_t groupSize[3], uint32_t slmArgsTotalSize, size_t suggestedGroupSize[3]) : groupSize(groupSize), slmArgsTotalSize(slmArgsTotalSize), suggestedGroupSize(suggestedGroupSize){};
-    };
-    std::vector<SuggestGroupSizeCacheEntry> suggestGroupSizeCache;
+    NEO::LocalWorkSizeCache suggestGroupSizeCache;
 };
 
 } // namespace L0
@@ -42,6 +42,14 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+void PageFaultManager::transferRangeToGpu(void *allocPtr, void *rangePtr, size_t rangeSize, void *device) {
+    // page fault copies cannot be offset, so the range is migrated together with the rest of the allocation
+    this->transferToGpu(allocPtr, device);
+}
+bool PageFaultManager::isRangeMigrationSupported() {
+    // chunked migration is disabled, page fault copies always cover whole allocation
+    return false;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(pageFaultData.cmdQ);
 
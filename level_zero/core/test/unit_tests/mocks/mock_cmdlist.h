@@ -684,10 +684,16 @@ class MockCommandListImmediateHw : public WhiteBox<::L0::CommandListCoreFamilyIm
     using BaseClass::dcFlushSupport;
     using BaseClass::dependenciesPresent;
     using BaseClass::dummyBlitWa;
+    using BaseClass::frontEndStateTracking;
+    using BaseClass::heaplessModeEnabled;
+    using BaseClass::immediateCmdListHeapSharing;
     using BaseClass::isFlushTaskSubmissionEnabled;
     using BaseClass::isSyncModeQueue;
     using BaseClass::isTbxMode;
+    using BaseClass::pipelineSelectStateTracking;
     using BaseClass::setupFillKernelArguments;
+    using BaseClass::stateBaseAddressTracking;
+    using BaseClass::stateComputeModeTracking;
 
     ze_result_t executeCommandListImmediate(bool performMigration) override {
         ++executeCommandListImmediateCalledCount;
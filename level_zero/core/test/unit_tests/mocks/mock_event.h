@@ -47,6 +47,7 @@ struct WhiteBox<::L0::EventImp<TagSizeT>> : public L0::EventImp<TagSizeT> {
     using BaseClass::maxKernelCount;
     using BaseClass::maxPacketCount;
     using BaseClass::signalAllEventPackets;
+    using BaseClass::signaledPacketsCount;
     using BaseClass::signalScope;
     using BaseClass::waitScope;
 };
@@ -284,6 +284,161 @@ HWTEST2_F(CommandListTest, givenCopyCommandListWhenRequiredFlushOperationThenExp
     EXPECT_EQ(usedBefore, usedAfter);
 }
 
+HWTEST2_F(CommandListTest, givenDeferredFlushThresholdWhenFlushingImmediateAppendsWithoutDependenciesThenAppendsAreSubmittedInBatches, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushThreshold.set(3);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::compute, 0u);
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.isSyncModeQueue = false;
+    cmdList.frontEndStateTracking = true;
+    cmdList.pipelineSelectStateTracking = true;
+    cmdList.stateComputeModeTracking = true;
+    cmdList.stateBaseAddressTracking = true;
+    cmdList.immediateCmdListHeapSharing = false;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(2u, cmdList.getDeferredAppendsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(1u, cmdList.getBatchedSubmissionsCount());
+    EXPECT_EQ(2u, cmdList.getSavedSubmissionsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.getDeferredAppendsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, true, false, true, false, nullptr));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(2u, cmdList.getBatchedSubmissionsCount());
+    EXPECT_EQ(3u, cmdList.getSavedSubmissionsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushDeferredAppends());
+    EXPECT_EQ(3u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(3u, cmdList.getBatchedSubmissionsCount());
+    EXPECT_EQ(3u, cmdList.getSavedSubmissionsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushDeferredAppends());
+    EXPECT_EQ(3u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(CommandListTest, givenDeferredFlushThresholdWhenStateIsNotTrackedInImmediateCmdListThenAppendsAreNotDeferred, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushThreshold.set(3);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::compute, 0u);
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.isSyncModeQueue = false;
+    cmdList.frontEndStateTracking = true;
+    cmdList.pipelineSelectStateTracking = true;
+    cmdList.stateComputeModeTracking = true;
+    cmdList.stateBaseAddressTracking = true;
+    cmdList.immediateCmdListHeapSharing = true;
+    cmdList.heaplessModeEnabled = false;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+
+    cmdList.immediateCmdListHeapSharing = false;
+    cmdList.stateComputeModeTracking = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getSavedSubmissionsCount());
+}
+
+HWTEST2_F(CommandListTest, givenDeferredAppendsWhenHeapIsReplacedThenOldHeapIsReusedOnlyAfterDeferredAppendsAreSubmitted, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushThreshold.set(8);
+
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ze_command_queue_desc_t queueDesc = {};
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.callBaseExecute = true;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.isSyncModeQueue = false;
+    auto commandQueue = CommandQueue::create(productFamily, device, &csr, &queueDesc, cmdList.isCopyOnly(), false, false, result);
+    cmdList.cmdQImmediate = commandQueue;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList.initialize(device, NEO::EngineGroupType::compute, 0u));
+    cmdList.getCmdContainer().setImmediateCmdListCsr(&csr);
+    cmdList.frontEndStateTracking = true;
+    cmdList.pipelineSelectStateTracking = true;
+    cmdList.stateComputeModeTracking = true;
+    cmdList.stateBaseAddressTracking = true;
+    cmdList.immediateCmdListHeapSharing = false;
+
+    auto ioh = cmdList.getCmdContainer().getIndirectHeap(NEO::HeapType::indirectObject);
+    ASSERT_NE(nullptr, ioh);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.getDeferredAppendsCount());
+
+    csr.flushTagUpdateCalled = false;
+    auto oldHeapAllocation = ioh->getGraphicsAllocation();
+    cmdList.getCmdContainer().getHeapWithRequiredSizeAndAlignment(NEO::HeapType::indirectObject, ioh->getAvailableSpace() + 1, 0);
+    EXPECT_NE(oldHeapAllocation, ioh->getGraphicsAllocation());
+    EXPECT_FALSE(csr.flushTagUpdateCalled);
+    EXPECT_TRUE(cmdList.getCmdContainer().hasAllocationsPendingSubmission());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_FALSE(cmdList.getCmdContainer().hasAllocationsPendingSubmission());
+    EXPECT_FALSE(csr.flushTagUpdateCalled);
+    EXPECT_EQ(csr.peekTaskCount(), oldHeapAllocation->getTaskCount(csr.getOsContext().getContextId()));
+
+    commandQueue->destroy();
+}
+
+HWTEST2_F(CommandListTest, givenDeferredAppendsWhenImmediateCmdListIsResetThenDeferredAppendsAreSubmitted, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ImmediateCmdListDeferredFlushThreshold.set(8);
+
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::compute, 0u);
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.isSyncModeQueue = false;
+    cmdList.frontEndStateTracking = true;
+    cmdList.pipelineSelectStateTracking = true;
+    cmdList.stateComputeModeTracking = true;
+    cmdList.stateBaseAddressTracking = true;
+    cmdList.immediateCmdListHeapSharing = false;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushImmediate(ZE_RESULT_SUCCESS, true, false, false, true, false, nullptr));
+    EXPECT_EQ(1u, cmdList.getDeferredAppendsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.reset());
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+}
+
 HWTEST2_F(CommandListTest, givenCopyCommandListWhenAppendCopyWithDependenciesThenDoNotTrackDependencies, IsAtLeastSkl) {
     ze_command_queue_desc_t queueDesc = {};
     auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
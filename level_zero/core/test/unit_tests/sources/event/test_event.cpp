@@ -1738,6 +1738,53 @@ TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForN
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(EventUsedPacketSignalSynchronizeTest, givenPartiallySignaledEventWhenQueryingStatusThenAlreadySignaledPacketsAreNotPolledAgainUntilReset) {
+    constexpr uint32_t packetsInUse = 3;
+    event->setPacketsInUse(packetsInUse);
+    event->setUsingContextEndOffset(false);
+
+    const size_t eventPacketSize = event->getSinglePacketSize();
+    auto packetAddress = [&](uint32_t packetId) {
+        return static_cast<uint32_t *>(ptrOffset(event->getHostAddress(), packetId * eventPacketSize + event->getContextStartOffset()));
+    };
+
+    *packetAddress(0) = Event::STATE_SIGNALED;
+    *packetAddress(1) = Event::STATE_SIGNALED;
+    *packetAddress(2) = Event::STATE_CLEARED;
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(2u, event->signaledPacketsCount.load());
+
+    *packetAddress(0) = Event::STATE_CLEARED;
+    *packetAddress(2) = Event::STATE_SIGNALED;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+
+    event->reset();
+    EXPECT_EQ(0u, event->signaledPacketsCount.load());
+
+    event->setPacketsInUse(packetsInUse);
+    *packetAddress(1) = Event::STATE_SIGNALED;
+    *packetAddress(2) = Event::STATE_SIGNALED;
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(0u, event->signaledPacketsCount.load());
+}
+
+TEST_F(EventUsedPacketSignalSynchronizeTest, givenHostCachingDisabledWhenQueryingPartiallySignaledEventThenSignaledPacketsAreNotCached) {
+    constexpr uint32_t packetsInUse = 2;
+    event->setPacketsInUse(packetsInUse);
+    event->setUsingContextEndOffset(false);
+    event->disableHostCaching(true);
+
+    auto hostAddr = static_cast<uint32_t *>(ptrOffset(event->getHostAddress(), event->getContextStartOffset()));
+    *hostAddr = Event::STATE_SIGNALED;
+    *ptrOffset(hostAddr, event->getSinglePacketSize()) = Event::STATE_CLEARED;
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(0u, event->signaledPacketsCount.load());
+}
+
 TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForOffsetedNonTimestampEventCompletionThenReturnOnlyAfterAllEventPacketsAreCompleted) {
     constexpr uint32_t packetsInUse = 2;
     event->setPacketsInUse(packetsInUse);
@@ -138,83 +138,41 @@ TEST_F(KernelImpTest, WhenSuggestingGroupSizeThenCacheValues) {
     EXPECT_EQ(kernel.getSlmTotalSize(), 0u);
 
     uint32_t groupSize[3];
+    Vec3<size_t> cachedGroupSize{0, 0, 0};
     kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find({{256, 1, 1}, 0u, 1u, false, false}, cachedGroupSize));
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(8, 1, 1));
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(groupSize[0], groupSize[1], groupSize[2]));
 
     kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(groupSize[0], groupSize[1], groupSize[2]));
 
     kernel.KernelImp::suggestGroupSize(2048, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 2u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[0], 2048u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find({{2048, 1, 1}, 0u, 1u, false, false}, cachedGroupSize));
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(8, 1, 1));
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(groupSize[0], groupSize[1], groupSize[2]));
 
     kernel.slmArgsTotalSize = 1;
+    EXPECT_FALSE(kernel.suggestGroupSizeCache.find({{2048, 1, 1}, 1u, 1u, false, false}, cachedGroupSize));
     kernel.KernelImp::suggestGroupSize(2048, 1, 1, groupSize, groupSize + 1, groupSize + 2);
 
     EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 3u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[0], 256u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].slmArgsTotalSize, 0u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[0], 2048u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[1].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].slmArgsTotalSize, 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].groupSize[0], 2048u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].groupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].groupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].suggestedGroupSize[0], 8u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].suggestedGroupSize[1], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[2].suggestedGroupSize[2], 1u);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[0], groupSize[0]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[1], groupSize[1]);
-    EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find({{2048, 1, 1}, 1u, 1u, false, false}, cachedGroupSize));
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(8, 1, 1));
+    EXPECT_EQ(cachedGroupSize, Vec3<size_t>(groupSize[0], groupSize[1], groupSize[2]));
+
+    NEO::debugManager.flags.EnableComputeWorkSizeSquared.set(true);
+    EXPECT_FALSE(kernel.suggestGroupSizeCache.find({{2048, 1, 1}, 1u, 1u, false, true}, cachedGroupSize));
+    kernel.KernelImp::suggestGroupSize(2048, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+
+    EXPECT_EQ(kernel.suggestGroupSizeCache.size(), 4u);
+    EXPECT_TRUE(kernel.suggestGroupSizeCache.find({{2048, 1, 1}, 1u, 1u, false, true}, cachedGroupSize));
 }
 
 class KernelImpSuggestGroupSize : public DeviceFixture, public ::testing::TestWithParam<uint32_t> {
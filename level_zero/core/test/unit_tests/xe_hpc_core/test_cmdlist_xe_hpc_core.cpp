@@ -633,6 +633,107 @@ HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenAppendMemoryPrefetchForKmdMigr
     commandQueue->destroy();
 }
 
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenPrefetchSharedKernelArgumentsSetWhenAppendingKernelUsingSharedAllocationThenAllocationIsAddedToPrefetchContextOnce, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(1);
+    debugManager.flags.PrefetchSharedKernelArguments.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    createKernel();
+    auto pCommandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = pCommandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(nullptr, ptr);
+
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, allocData);
+    auto allocation = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    ASSERT_EQ(NEO::AllocationType::unifiedSharedMemory, allocation->getAllocationType());
+    kernel->residencyContainer.push_back(allocation);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = pCommandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    result = pCommandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_TRUE(pCommandList->isMemoryPrefetchRequested());
+    ASSERT_EQ(1u, pCommandList->getPrefetchContext().allocations.size());
+    EXPECT_EQ(ptr, pCommandList->getPrefetchContext().allocations[0]);
+
+    pCommandList->reset();
+    kernel->residencyContainer.pop_back();
+    context->freeMem(ptr);
+}
+
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenPrefetchSharedKernelArgumentsSetAndImmediateCommandListWhenInsertingSharedKernelAllocationsThenNothingIsAddedToPrefetchContext, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(1);
+    debugManager.flags.PrefetchSharedKernelArguments.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    auto pCommandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = pCommandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    pCommandList->cmdListType = CommandList::CommandListType::typeImmediate;
+
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 10, 1u, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto allocation = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    pCommandList->insertSharedKernelAllocationsForPrefetch({allocation});
+
+    EXPECT_FALSE(pCommandList->isMemoryPrefetchRequested());
+    EXPECT_EQ(0u, pCommandList->getPrefetchContext().allocations.size());
+
+    pCommandList->cmdListType = CommandList::CommandListType::typeRegular;
+    context->freeMem(ptr);
+}
+
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenPrefetchSharedKernelArgumentsSetAndNoKmdMigrationWhenInsertingSharedKernelAllocationsThenNothingIsAddedToPrefetchContext, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(0);
+    debugManager.flags.PrefetchSharedKernelArguments.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    auto pCommandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = pCommandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 10, 1u, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto allocation = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    pCommandList->insertSharedKernelAllocationsForPrefetch({allocation});
+
+    EXPECT_FALSE(pCommandList->isMemoryPrefetchRequested());
+    EXPECT_EQ(0u, pCommandList->getPrefetchContext().allocations.size());
+
+    context->freeMem(ptr);
+}
+
 using CommandListEventFenceTestsXeHpcCore = Test<ModuleFixture>;
 
 HWTEST2_F(CommandListEventFenceTestsXeHpcCore, givenCommandListWithProfilingEventAfterCommandWhenRevId03ThenMiFenceIsAdded, IsXeHpcCore) {
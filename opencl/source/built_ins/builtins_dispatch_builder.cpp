@@ -8,9 +8,11 @@
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
 
 #include "opencl/source/built_ins/aux_translation_builtin.h"
 #include "opencl/source/built_ins/built_ins.inl"
@@ -335,6 +337,16 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
         size_t middleAlignment = MemoryConstants::cacheLineSize;
         size_t middleElSize = sizeof(uint32_t);
 
+        // Patterns of up to 4 bytes are expanded to a dword by the caller, so the middle region
+        // can be filled with an immediate value, 16 bytes per work item, without reading the pattern
+        bool useImmediateMiddle = (debugManager.flags.EnableImmediateFillBufferMiddle.get() == 1) &&
+                                  (kernMiddleImmediate != nullptr) &&
+                                  (operationParams.srcMemObj->getSize() == sizeof(uint32_t)) &&
+                                  (operationParams.srcMemObj->getCpuAddress() != nullptr);
+        if (useImmediateMiddle) {
+            middleElSize = 4 * sizeof(uint32_t);
+        }
+
         uintptr_t leftSize = start % middleAlignment;
         leftSize = (leftSize > 0) ? (middleAlignment - leftSize) : 0; // calc left leftover size
         leftSize = std::min(leftSize, operationParams.size.x);        // clamp left leftover size to requested size
@@ -350,7 +362,7 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::left, kernLeftLeftover->getKernel(rootDeviceIndex));
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddle->getKernel(rootDeviceIndex));
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, (useImmediateMiddle ? kernMiddleImmediate : kernMiddle)->getKernel(rootDeviceIndex));
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::right, kernRightLeftover->getKernel(rootDeviceIndex));
 
         DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
@@ -369,18 +381,30 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
 
         // Set-up dstOffset
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::left, 1, static_cast<OffsetType>(operationParams.dstOffset.x));
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 1, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::right, 1, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize + middleSizeBytes));
 
         // Set-up srcMemObj with pattern
         auto graphicsAllocation = operationParams.srcMemObj->getMultiGraphicsAllocation().getDefaultGraphicsAllocation();
-        kernelSplit1DBuilder.setArgSvm(2, operationParams.srcMemObj->getSize(), reinterpret_cast<void *>(graphicsAllocation->getGpuAddressToPatch()), graphicsAllocation, CL_MEM_READ_ONLY);
+        auto patternGpuAddress = reinterpret_cast<void *>(graphicsAllocation->getGpuAddressToPatch());
+        kernelSplit1DBuilder.setArgSvm(SplitDispatch::RegionCoordX::left, 2, operationParams.srcMemObj->getSize(), patternGpuAddress, graphicsAllocation, CL_MEM_READ_ONLY);
+        kernelSplit1DBuilder.setArgSvm(SplitDispatch::RegionCoordX::right, 2, operationParams.srcMemObj->getSize(), patternGpuAddress, graphicsAllocation, CL_MEM_READ_ONLY);
 
         // Set-up patternSizeInEls
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::left, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize() / middleElSize));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::right, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
 
+        // Set-up middle region, FillBufferImmediate takes ulong offset and the pattern value
+        if (useImmediateMiddle) {
+            uint32_t patternValue = 0u;
+            memcpy_s(&patternValue, sizeof(patternValue), operationParams.srcMemObj->getCpuAddress(), sizeof(uint32_t));
+            kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 1, static_cast<uint64_t>(operationParams.dstOffset.x + leftSize));
+            kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 2, patternValue);
+        } else {
+            kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 1, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize));
+            kernelSplit1DBuilder.setArgSvm(SplitDispatch::RegionCoordX::middle, 2, operationParams.srcMemObj->getSize(), patternGpuAddress, graphicsAllocation, CL_MEM_READ_ONLY);
+            kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::middle, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize() / middleElSize));
+        }
+
         // Set-up work sizes
         // Note for split walker, it would be just builder.SetDipatchGeomtry(GWS, ELWS, OFFSET)
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::left, Vec3<size_t>{leftSize, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
@@ -398,6 +422,7 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
   protected:
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
+    MultiDeviceKernel *kernMiddleImmediate = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
@@ -407,6 +432,7 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
                      "",
                      "FillBufferLeftLeftover", kernLeftLeftover,
                      "FillBufferMiddle", kernMiddle,
+                     "FillBufferImmediate", kernMiddleImmediate,
                      "FillBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -420,6 +446,7 @@ class BuiltInOp<EBuiltInOps::fillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferImmediate", kernMiddleImmediate,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
@@ -435,6 +462,7 @@ class BuiltInOp<EBuiltInOps::fillBufferStatelessHeapless> : public BuiltInOp<EBu
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferImmediate", kernMiddleImmediate,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
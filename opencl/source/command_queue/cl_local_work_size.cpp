@@ -11,6 +11,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_work_size.h"
+#include "shared/source/helpers/local_work_size_cache.h"
 #include "shared/source/utilities/logger.h"
 
 #include "opencl/source/context/context.h"
@@ -25,7 +26,16 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
     auto kernel = dispatchInfo.getKernel();
 
     if (kernel != nullptr) {
-        if (debugManager.flags.EnableComputeWorkSizeND.get()) {
+        const LocalWorkSizeCacheKey cacheKey{dispatchInfo.getGWS(), kernel->getSlmTotalSize(), dispatchInfo.getDim(),
+                                             debugManager.flags.EnableComputeWorkSizeND.get(), debugManager.flags.EnableComputeWorkSizeSquared.get()};
+        Vec3<size_t> cachedLws{0, 0, 0};
+        if (kernel->getLocalWorkSizeCache().find(cacheKey, cachedLws)) {
+            DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
+                    " Driver cached LWS", cachedLws.x, cachedLws.y, cachedLws.z);
+            return cachedLws;
+        }
+
+        if (cacheKey.computeWorkSizeND) {
             WorkSizeInfo wsInfo = createWorkSizeInfoFromDispatchInfo(dispatchInfo);
             size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
             computeWorkgroupSizeND(wsInfo, workGroupSize, workItems, dispatchInfo.getDim());
@@ -35,12 +45,13 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
             size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
             if (dispatchInfo.getDim() == 1) {
                 computeWorkgroupSize1D(maxWorkGroupSize, workGroupSize, workItems, simd);
-            } else if (debugManager.flags.EnableComputeWorkSizeSquared.get() && dispatchInfo.getDim() == 2) {
+            } else if (cacheKey.computeWorkSizeSquared && dispatchInfo.getDim() == 2) {
                 computeWorkgroupSizeSquared(maxWorkGroupSize, workGroupSize, workItems, simd, dispatchInfo.getDim());
             } else {
                 computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
             }
         }
+        kernel->getLocalWorkSizeCache().insert(cacheKey, workGroupSize);
     }
     DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
             " Driver deduced LWS", workGroupSize[0], workGroupSize[1], workGroupSize[2]);
@@ -1024,6 +1024,13 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
         return false;
     }
 
+    // small blocking transfers to device memory are cheaper through a locked pointer than a GPU round trip
+    if (!debugVariableSet && blocking == CL_TRUE && numEventsInWaitList == 0 &&
+        buffer->isReadWriteThroughLockedPtrPreferred(commandType, size, device->getDevice())) {
+        // fall back to the GPU path if the allocation cannot be locked
+        return buffer->getMemoryManager()->lockResource(buffer->getGraphicsAllocation(device->getRootDeviceIndex())) != nullptr;
+    }
+
     // check if buffer is compatible
     if (!buffer->isReadWriteOnCpuAllowed(device->getDevice())) {
         return false;
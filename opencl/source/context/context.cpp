@@ -540,6 +540,28 @@ void Context::cleanupUsmAllocationPools() {
     usmHostMemAllocPool.cleanup();
 }
 
+void Context::BufferPoolAllocator::releasePools() {
+    BaseType::releasePools();
+    this->smallTierBufferPools.clear();
+}
+
+bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) const {
+    if (BaseType::isPoolBuffer(buffer)) {
+        return true;
+    }
+    for (auto &bufferPool : this->smallTierBufferPools) {
+        if (bufferPool.isPoolBuffer(buffer)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Context::BufferPoolAllocator::tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size) {
+    BaseType::tryFreeFromPoolBuffer(possiblePoolBuffer, offset, size, this->bufferPools);
+    BaseType::tryFreeFromPoolBuffer(possiblePoolBuffer, offset, size, this->smallTierBufferPools);
+}
+
 bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *context) const {
     bool isSupportedForSingleDeviceContexts = false;
     bool isSupportedForAllContexts = false;
@@ -558,7 +580,7 @@ bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *cont
            (isSupportedForSingleDeviceContexts && context->isSingleDeviceContext());
 }
 
-Context::BufferPool::BufferPool(Context *context) : BaseType(context->memoryManager, nullptr) {
+Context::BufferPool::BufferPool(Context *context, size_t poolChunkAlignment) : BaseType(context->memoryManager, nullptr) {
     static constexpr cl_mem_flags flags{};
     [[maybe_unused]] cl_int errcodeRet{};
     Buffer::AdditionalBufferCreateArgs bufferCreateArgs{};
@@ -573,7 +595,7 @@ Context::BufferPool::BufferPool(Context *context) : BaseType(context->memoryMana
     if (this->mainStorage) {
         this->chunkAllocator.reset(new HeapAllocator(BufferPool::startingOffset,
                                                      BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                                     BufferPoolAllocator::chunkAlignment));
+                                                     poolChunkAlignment));
         context->decRefInternal();
     }
 }
@@ -625,21 +647,39 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
     }
 
     auto lock = std::unique_lock<std::mutex>(mutex);
-    auto bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    if (this->isSizeWithinSmallTierThreshold(requestedSize)) {
+        auto bufferFromPool = this->allocateFromTier(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, this->smallTierBufferPools, smallTierChunkAlignment);
+        if (bufferFromPool != nullptr) {
+            return bufferFromPool;
+        }
+        // pool budget is exhausted, small buffers fall back to free space of regular pools
+    }
+    return this->allocateFromTier(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, this->bufferPools, chunkAlignment);
+}
+
+Buffer *Context::BufferPoolAllocator::allocateFromTier(const MemoryProperties &memoryProperties,
+                                                       cl_mem_flags flags,
+                                                       cl_mem_flags_intel flagsIntel,
+                                                       size_t requestedSize,
+                                                       void *hostPtr,
+                                                       cl_int &errcodeRet,
+                                                       std::vector<BufferPool> &bufferPoolsVec,
+                                                       size_t poolChunkAlignment) {
+    auto bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, bufferPoolsVec);
     if (bufferFromPool != nullptr) {
         return bufferFromPool;
     }
 
-    this->drain();
+    this->drain(bufferPoolsVec);
 
-    bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, bufferPoolsVec);
     if (bufferFromPool != nullptr) {
         return bufferFromPool;
     }
 
-    if (this->bufferPools.size() < this->maxPoolCount) {
-        this->addNewBufferPool(BufferPool{this->context});
-        return this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
+    if (this->bufferPools.size() + this->smallTierBufferPools.size() < this->maxPoolCount) {
+        this->addNewBufferPool(BufferPool{this->context, poolChunkAlignment}, bufferPoolsVec);
+        return this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet, bufferPoolsVec);
     }
     return nullptr;
 }
@@ -649,8 +689,9 @@ Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &
                                                         cl_mem_flags_intel flagsIntel,
                                                         size_t requestedSize,
                                                         void *hostPtr,
-                                                        cl_int &errcodeRet) {
-    for (auto &bufferPoolParent : this->bufferPools) {
+                                                        cl_int &errcodeRet,
+                                                        std::vector<BufferPool> &bufferPoolsVec) {
+    for (auto &bufferPoolParent : bufferPoolsVec) {
         auto &bufferPool = static_cast<BufferPool &>(bufferPoolParent);
         auto bufferFromPool = bufferPool.allocate(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
         if (bufferFromPool != nullptr) {
@@ -57,7 +57,7 @@ class Context : public BaseObject<_cl_context> {
     struct BufferPool : public AbstractBuffersPool<BufferPool, Buffer, MemObj> {
         using BaseType = AbstractBuffersPool<BufferPool, Buffer, MemObj>;
 
-        BufferPool(Context *context);
+        BufferPool(Context *context, size_t poolChunkAlignment = BufferPool::chunkAlignment);
         Buffer *allocate(const MemoryProperties &memoryProperties,
                          cl_mem_flags flags,
                          cl_mem_flags_intel flagsIntel,
@@ -70,6 +70,18 @@ class Context : public BaseObject<_cl_context> {
 
     class BufferPoolAllocator : public AbstractBuffersAllocator<BufferPool, Buffer, MemObj> {
       public:
+        using BaseType = AbstractBuffersAllocator<BufferPool, Buffer, MemObj>;
+
+        // Buffers up to this size are served from separate pools with page granularity chunks,
+        // so that they do not occupy a whole chunkAlignment sized chunk each. Both tiers share maxPoolCount;
+        // small buffers use regular pools only when no small tier pool has space and none can be created.
+        static constexpr auto smallTierBufferThreshold = 16 * MemoryConstants::kiloByte;
+        static constexpr auto smallTierChunkAlignment = MemoryConstants::pageSize;
+        static_assert(smallTierBufferThreshold < chunkAlignment, "Small tier is meant for buffers smaller than regular chunk");
+
+        void releasePools() override;
+        bool isPoolBuffer(const MemObj *buffer) const override;
+        void tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size) override;
         bool isAggregatedSmallBuffersEnabled(Context *context) const;
         void initAggregatedSmallBuffers(Context *context);
         Buffer *allocateBufferFromPool(const MemoryProperties &memoryProperties,
@@ -86,7 +98,17 @@ class Context : public BaseObject<_cl_context> {
                                   cl_mem_flags_intel flagsIntel,
                                   size_t requestedSize,
                                   void *hostPtr,
-                                  cl_int &errcodeRet);
+                                  cl_int &errcodeRet,
+                                  std::vector<BufferPool> &bufferPoolsVec);
+        Buffer *allocateFromTier(const MemoryProperties &memoryProperties,
+                                 cl_mem_flags flags,
+                                 cl_mem_flags_intel flagsIntel,
+                                 size_t requestedSize,
+                                 void *hostPtr,
+                                 cl_int &errcodeRet,
+                                 std::vector<BufferPool> &bufferPoolsVec,
+                                 size_t poolChunkAlignment);
+        inline bool isSizeWithinSmallTierThreshold(size_t size) const { return smallTierBufferThreshold >= size; }
         static inline size_t calculateMaxPoolCount(uint64_t totalMemory, size_t percentOfMemory) {
             const auto maxPoolCount = static_cast<size_t>(totalMemory * (percentOfMemory / 100.0) / BufferPoolAllocator::aggregatedSmallBuffersPoolSize);
             return maxPoolCount ? maxPoolCount : 1u;
@@ -94,6 +116,7 @@ class Context : public BaseObject<_cl_context> {
 
         Context *context{nullptr};
         size_t maxPoolCount{1u};
+        std::vector<BufferPool> smallTierBufferPools;
     };
 
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
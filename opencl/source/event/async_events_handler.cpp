@@ -13,6 +13,7 @@
 
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
@@ -37,13 +38,35 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+void AsyncEventsHandler::notifyEventStatusChange() {
+    // may be called from within processList, so asyncMtx can't be taken here;
+    // a wakeup lost to the race with the waiting thread is bounded by blockedEventsWaitTimeout
+    eventsUpdated = true;
+    asyncCond.notify_one();
+}
+
 Event *AsyncEventsHandler::processList() {
     TaskCountType lowestTaskCount = CompletionStamp::notReady;
     Event *sleepCandidate = nullptr;
     pendingList.clear();
+    incompleteTaskCounts.clear();
 
     for (auto event : list) {
+        auto csr = event->getCsrForOrderedCompletionCheck();
+        if (!isCompletionPossible(csr, event->peekTaskCount())) {
+            // an earlier task of the same CSR is still running, so this one can't be done yet
+            if (event->peekHasCallbacks()) {
+                pendingList.push_back(event);
+            } else {
+                event->decRefInternal();
+            }
+            continue;
+        }
+
         event->updateExecutionStatus();
+        if (csr && event->peekExecutionStatus() == CL_SUBMITTED) {
+            trackIncompleteTaskCount(csr, event->peekTaskCount());
+        }
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
@@ -59,6 +82,28 @@ Event *AsyncEventsHandler::processList() {
     return sleepCandidate;
 }
 
+bool AsyncEventsHandler::isCompletionPossible(const CommandStreamReceiver *csr, TaskCountType taskCount) const {
+    if (csr == nullptr) {
+        return true;
+    }
+    for (const auto &incompleteTaskCount : incompleteTaskCounts) {
+        if (incompleteTaskCount.first == csr) {
+            return taskCount <= incompleteTaskCount.second;
+        }
+    }
+    return true;
+}
+
+void AsyncEventsHandler::trackIncompleteTaskCount(const CommandStreamReceiver *csr, TaskCountType taskCount) {
+    for (auto &incompleteTaskCount : incompleteTaskCounts) {
+        if (incompleteTaskCount.first == csr) {
+            incompleteTaskCount.second = std::min(incompleteTaskCount.second, taskCount);
+            return;
+        }
+    }
+    incompleteTaskCounts.push_back({csr, taskCount});
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -76,6 +121,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
         if (self->list.empty()) {
             self->asyncCond.wait(lock);
         }
+        self->eventsUpdated = false;
         lock.unlock();
 
         sleepCandidate = self->processList();
@@ -84,6 +130,13 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             if (waitStatus == WaitStatus::gpuHang) {
                 sleepCandidate->abortExecutionDueToGpuHang();
             }
+        } else if (!self->list.empty()) {
+            // all remaining events are still blocked, sleep until any event gets submitted instead of spinning
+            lock.lock();
+            self->asyncCond.wait_for(lock, blockedEventsWaitTimeout, [self]() {
+                return self->eventsUpdated || !self->registerList.empty() || !self->allowAsyncProcess;
+            });
+            lock.unlock();
         }
         std::this_thread::yield();
     }
@@ -6,25 +6,36 @@
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/utilities/stackvec.h"
+
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
 class AsyncEventsHandler {
   public:
+    static constexpr std::chrono::milliseconds blockedEventsWaitTimeout{10};
+
     AsyncEventsHandler();
     virtual ~AsyncEventsHandler();
     void registerEvent(Event *event);
+    void notifyEventStatusChange();
     void closeThread();
 
   protected:
     Event *processList();
+    bool isCompletionPossible(const CommandStreamReceiver *csr, TaskCountType taskCount) const;
+    void trackIncompleteTaskCount(const CommandStreamReceiver *csr, TaskCountType taskCount);
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,10 +43,12 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    StackVec<std::pair<const CommandStreamReceiver *, TaskCountType>, 4> incompleteTaskCounts; // lowest not completed task count per CSR seen in current pass
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
     std::atomic<bool> allowAsyncProcess;
+    std::atomic<bool> eventsUpdated{false};
 };
 } // namespace NEO
@@ -476,14 +476,7 @@ void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContai
         if (!timestamp->isProfilingCapable()) {
             continue;
         }
-        for (auto i = 0u; i < timestamp->getPacketsUsed(); ++i) {
-            if (globalStartTS > timestamp->getGlobalStartValue(i)) {
-                globalStartTS = timestamp->getGlobalStartValue(i);
-            }
-            if (globalEndTS < timestamp->getGlobalEndValue(i)) {
-                globalEndTS = timestamp->getGlobalEndValue(i);
-            }
-        }
+        timestamp->updateGlobalBoundaryValues(globalStartTS, globalEndTS);
     }
 }
 
@@ -563,6 +556,17 @@ void Event::updateExecutionStatus() {
     transitionExecutionStatus(CL_SUBMITTED);
 }
 
+const CommandStreamReceiver *Event::getCsrForOrderedCompletionCheck() const {
+    // events completed only by their gpgpu CSR tag complete in task count order
+    if ((cmdQueue == nullptr) || (executionStatus != CL_SUBMITTED) || gpuStateWaited || peekIsBlocked() || isExternallySynchronized() || bcsState.isValid()) {
+        return nullptr;
+    }
+    if (timestampPacketContainer.get() && isWaitForTimestampsEnabled()) {
+        return nullptr;
+    }
+    return &cmdQueue->getGpgpuCommandStreamReceiver();
+}
+
 void Event::addChild(Event &childEvent) {
     childEvent.parentCount++;
     childEvent.incRefInternal();
@@ -635,6 +639,9 @@ bool Event::setStatus(cl_int status) {
         unblockEventsBlockedByThis(status);
     }
     executeCallbacks(status);
+    if (ctx && peekHasCallbacks() && !isUserEvent() && debugManager.flags.EnableAsyncEventsHandler.get()) {
+        ctx->getAsyncEventsHandler().notifyEventStatusChange();
+    }
     this->decRefInternal();
     return true;
 }
@@ -824,12 +831,11 @@ bool Event::isWaitForTimestampsEnabled() const {
 bool Event::areTimestampsCompleted() {
     if (this->timestampPacketContainer.get()) {
         if (this->isWaitForTimestampsEnabled()) {
+            auto &gpgpuCsr = this->cmdQueue->getGpgpuCommandStreamReceiver();
             for (const auto &timestamp : this->timestampPacketContainer->peekNodes()) {
-                for (uint32_t i = 0; i < timestamp->getPacketsUsed(); i++) {
-                    this->cmdQueue->getGpgpuCommandStreamReceiver().downloadAllocation(*timestamp->getBaseGraphicsAllocation()->getGraphicsAllocation(this->cmdQueue->getGpgpuCommandStreamReceiver().getRootDeviceIndex()));
-                    if (timestamp->getContextEndValue(i) == 1) {
-                        return false;
-                    }
+                gpgpuCsr.downloadAllocation(*timestamp->getBaseGraphicsAllocation()->getGraphicsAllocation(gpgpuCsr.getRootDeviceIndex()));
+                if (!timestamp->areAllPacketsCompleted()) {
+                    return false;
                 }
             }
             this->cmdQueue->getGpgpuCommandStreamReceiver().downloadAllocations();
@@ -26,6 +26,7 @@ class FlushStampTracker;
 template <typename TagType>
 class TagNode;
 class CommandQueue;
+class CommandStreamReceiver;
 class Context;
 class Device;
 class TimestampPacketContainer;
@@ -288,6 +289,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     virtual void updateExecutionStatus();
     bool tryFlushEvent();
+    const CommandStreamReceiver *getCsrForOrderedCompletionCheck() const;
 
     TaskCountType peekTaskCount() const {
         return this->taskCount;
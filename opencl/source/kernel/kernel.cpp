@@ -1408,9 +1408,7 @@ void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
 
     gtpinNotifyMakeResident(this, &commandStreamReceiver);
 
-    if (getHasIndirectAccess() && (unifiedMemoryControls.indirectDeviceAllocationsAllowed ||
-                                   unifiedMemoryControls.indirectHostAllocationsAllowed ||
-                                   unifiedMemoryControls.indirectSharedAllocationsAllowed)) {
+    if (canAccessIndirectAllocations()) {
         auto svmAllocsManager = this->getContext().getSVMAllocsManager();
         auto submittedAsPack = svmAllocsManager->submitIndirectAllocationsAsPack(commandStreamReceiver);
         if (!submittedAsPack) {
@@ -2049,9 +2047,17 @@ std::unique_ptr<KernelObjsForAuxTranslation> Kernel::fillWithKernelObjsForAuxTra
             }
         }
         if (getContext().getSVMAllocsManager()) {
+            // Allocations which are neither kernel arguments nor resident for indirect access cannot be reached by the kernel
+            const bool skipUnreachableAllocations = debugManager.flags.SkipAuxTranslationOfUnreachableAllocations.get() == 1 && !canAccessIndirectAllocations();
             for (auto &allocation : getContext().getSVMAllocsManager()->getSVMAllocs()->allocations) {
                 auto gfxAllocation = allocation.second->gpuAllocations.getDefaultGraphicsAllocation();
                 if (gfxAllocation->isCompressionEnabled()) {
+                    if (skipUnreachableAllocations &&
+                        kernelObjsForAuxTranslation->find({KernelObjForAuxTranslation::Type::gfxAlloc, gfxAllocation}) == kernelObjsForAuxTranslation->end() &&
+                        std::find(kernelSvmGfxAllocations.begin(), kernelSvmGfxAllocations.end(), gfxAllocation) == kernelSvmGfxAllocations.end()) {
+                        auxTranslationsAvoidedCount++;
+                        continue;
+                    }
                     kernelObjsForAuxTranslation->insert({KernelObjForAuxTranslation::Type::gfxAlloc, gfxAllocation});
                     auto &context = this->program->getContext();
                     if (context.isProvidingPerformanceHints()) {
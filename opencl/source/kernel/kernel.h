@@ -10,6 +10,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/aux_translation.h"
+#include "shared/source/helpers/local_work_size_cache.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/kernel/kernel_execution_type.h"
@@ -374,10 +375,19 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     uint32_t getMaxKernelWorkGroupSize() const;
     uint32_t getSlmTotalSize() const;
+    LocalWorkSizeCache &getLocalWorkSizeCache() { return localWorkSizeCache; }
     bool getHasIndirectAccess() const {
         return this->kernelHasIndirectAccess;
     }
 
+    bool canAccessIndirectAllocations() const {
+        return getHasIndirectAccess() && (unifiedMemoryControls.indirectDeviceAllocationsAllowed ||
+                                          unifiedMemoryControls.indirectHostAllocationsAllowed ||
+                                          unifiedMemoryControls.indirectSharedAllocationsAllowed);
+    }
+
+    uint32_t getAuxTranslationsAvoidedCount() const { return auxTranslationsAvoidedCount; }
+
     MultiDeviceKernel *getMultiDeviceKernel() const { return pMultiDeviceKernel; }
     void setMultiDeviceKernel(MultiDeviceKernel *pMultiDeviceKernelToSet) { pMultiDeviceKernel = pMultiDeviceKernelToSet; }
 
@@ -470,6 +480,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     void initializeLocalIdsCache();
     std::unique_ptr<LocalIdsCache> localIdsCache;
+    LocalWorkSizeCache localWorkSizeCache;
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
@@ -510,6 +521,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     KernelExecutionType executionType = KernelExecutionType::defaultType;
 
     uint32_t patchedArgumentsNum = 0;
+    uint32_t auxTranslationsAvoidedCount = 0;
     uint32_t startOffset = 0;
     uint32_t statelessUncacheableArgsCount = 0;
     uint32_t additionalKernelExecInfo = AdditionalKernelExecInfo::disableOverdispatch;
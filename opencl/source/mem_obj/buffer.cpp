@@ -802,6 +802,42 @@ bool Buffer::isReadWriteOnCpuPreferred(void *ptr, size_t size, const Device &dev
     return false;
 }
 
+bool Buffer::isReadWriteThroughLockedPtrPreferred(cl_command_type commandType, size_t size, const Device &device) {
+    if (debugManager.flags.DoCpuCopyThroughLockOnReadWriteBuffer.get() != 1) {
+        return false;
+    }
+
+    auto rootDeviceIndex = device.getRootDeviceIndex();
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+
+    if (!allowCpuAccess() || forceDisallowCPUCopy || isCompressed(rootDeviceIndex) || graphicsAllocation->peekSharedHandle() != 0) {
+        return false;
+    }
+
+    // CPU transfers bypass the migration of multi storage allocations done when enqueueing on GPU
+    if (multiGraphicsAllocation.requiresMigrations()) {
+        return false;
+    }
+
+    if (!graphicsAllocation->isAllocatedInLocalMemoryPool() || !graphicsAllocation->isAllocationLockable() ||
+        graphicsAllocation->storageInfo.getNumBanks() != 1) {
+        return false;
+    }
+
+    // reads from device memory are uncached on CPU side, so only tiny ones are worth it
+    size_t maxSize = maxWriteSizeThroughLockedPtr;
+    if (commandType == CL_COMMAND_READ_BUFFER) {
+        maxSize = maxReadSizeThroughLockedPtr;
+        if (debugManager.flags.ExperimentalD2HCpuCopyThreshold.get() != -1) {
+            maxSize = debugManager.flags.ExperimentalD2HCpuCopyThreshold.get();
+        }
+    } else if (debugManager.flags.ExperimentalH2DCpuCopyThreshold.get() != -1) {
+        maxSize = debugManager.flags.ExperimentalH2DCpuCopyThreshold.get();
+    }
+
+    return size <= maxSize;
+}
+
 Buffer *Buffer::createBufferHw(Context *context,
                                const MemoryProperties &memoryProperties,
                                cl_mem_flags flags,
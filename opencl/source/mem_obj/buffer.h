@@ -60,6 +60,8 @@ class Buffer : public MemObj {
         bool makeAllocationLockable;
     };
     constexpr static size_t maxBufferSizeForReadWriteOnCpu = 10 * MemoryConstants::megaByte;
+    constexpr static size_t maxReadSizeThroughLockedPtr = 1 * MemoryConstants::kiloByte;
+    constexpr static size_t maxWriteSizeThroughLockedPtr = 4 * MemoryConstants::megaByte;
     constexpr static size_t maxBufferSizeForCopyOnCpu = 64 * MemoryConstants::kiloByte;
     constexpr static cl_ulong maskMagic = 0xFFFFFFFFFFFFFFFFLL;
     constexpr static cl_ulong objectMagic = MemObj::objectMagic | 0x02;
@@ -174,6 +176,7 @@ class Buffer : public MemObj {
 
     bool isReadWriteOnCpuAllowed(const Device &device);
     bool isReadWriteOnCpuPreferred(void *ptr, size_t size, const Device &device);
+    bool isReadWriteThroughLockedPtrPreferred(cl_command_type commandType, size_t size, const Device &device);
 
     uint32_t getMocsValue(bool disableL3Cache, bool isReadOnlyArgument, uint32_t rootDeviceIndex) const;
     uint32_t getSurfaceSize(bool alignSizeForAuxTranslation, uint32_t rootDeviceIndex) const;
@@ -149,6 +149,21 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
     }
 }
 
+bool Image::isCpuTiledTransferPreferred(const GraphicsAllocation &allocation) const {
+    auto maxSizeInKb = debugManager.flags.CpuTiledImageTransferMaxSize.get();
+    if (maxSizeInKb <= 0) {
+        return false;
+    }
+    if (imageDesc.image_type != CL_MEM_OBJECT_IMAGE2D || mipCount > 1 || isNV12Image(&imageFormat)) {
+        return false;
+    }
+    auto gmm = allocation.getDefaultGmm();
+    if (!gmm || gmm->isCompressionEnabled() || !allocation.isAllocationLockable()) {
+        return false;
+    }
+    return allocation.getUnderlyingBufferSize() <= static_cast<size_t>(maxSizeInKb) * MemoryConstants::kiloByte;
+}
+
 Image *Image::create(Context *context,
                      const MemoryProperties &memoryProperties,
                      cl_mem_flags flags,
@@ -325,6 +340,8 @@ Image *Image::create(Context *context,
         auto allocationInSystemMemory = MemoryPoolHelper::isSystemMemoryPool(memory->getMemoryPool());
         bool isCpuTransferPreferred = imgInfo.linearStorage && defaultGfxCoreHelper.isCpuImageTransferPreferred(defaultHwInfo);
         bool isCpuTransferPreferredInSystemMemory = imgInfo.linearStorage && allocationInSystemMemory;
+        bool isCpuTiledTransferPreferred = !imgInfo.linearStorage && image->isCpuTiledTransferPreferred(*memory);
+        void *pTiledDestinationAddress = isCpuTiledTransferPreferred ? context->getMemoryManager()->lockResource(memory) : nullptr;
 
         if (isCpuTransferPreferredInSystemMemory) {
             void *pDestinationAddress = memory->getUnderlyingBuffer();
@@ -339,6 +356,14 @@ Image *Image::create(Context *context,
                                 copyRegion, copyOrigin);
             context->getMemoryManager()->unlockResource(memory);
 
+        } else if (pTiledDestinationAddress) {
+            auto uploaded = memory->getDefaultGmm()->resourceCopyBlt(const_cast<void *>(hostPtr), pTiledDestinationAddress, static_cast<uint32_t>(hostPtrRowPitch),
+                                                                     static_cast<uint32_t>(imageHeight), 1u, ImagePlane::noPlane);
+            context->getMemoryManager()->unlockResource(memory);
+            if (!uploaded) {
+                errcodeRet = CL_OUT_OF_RESOURCES;
+            }
+
         } else {
             auto cmdQ = context->getSpecialQueue(defaultRootDeviceIndex);
             if (isNV12Image(&image->getImageFormat())) {
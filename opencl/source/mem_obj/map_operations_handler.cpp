@@ -7,8 +7,11 @@
 
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/ptr_math.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 size_t MapOperationsHandler::size() const {
@@ -27,6 +30,9 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
     }
 
     mappedPointers.push_back(mapInfo);
+    if (storage) {
+        storage->registerMappedPtr(this, mapInfo);
+    }
     return true;
 }
 
@@ -82,6 +88,9 @@ void MapOperationsHandler::remove(void *mappedPtr) {
     auto endIter = mappedPointers.end();
     for (auto it = mappedPointers.begin(); it != endIter; it++) {
         if (it->ptr == mappedPtr) {
+            if (storage) {
+                storage->unregisterMappedPtr(this, *it);
+            }
             std::iter_swap(it, mappedPointers.end() - 1);
             mappedPointers.pop_back();
             break;
@@ -91,7 +100,9 @@ void MapOperationsHandler::remove(void *mappedPtr) {
 
 MapOperationsHandler &NEO::MapOperationsStorage::getHandler(cl_mem memObj) {
     std::lock_guard<std::mutex> lock(mutex);
-    return handlers[memObj];
+    auto &handler = handlers[memObj];
+    handler.storage = this;
+    return handler;
 }
 
 MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memObj) {
@@ -104,11 +115,32 @@ MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memOb
     return &iterator->second;
 }
 
+uint32_t NEO::MapOperationsStorage::getMappedPtrLengthBucket(size_t ptrLength) {
+    return Math::log2(static_cast<uint64_t>(std::max(ptrLength, static_cast<size_t>(1u))));
+}
+
 bool NEO::MapOperationsStorage::getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo) {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (auto &entry : handlers) {
-        if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
-            return true;
+    std::lock_guard<std::mutex> lock(indexMutex);
+    const auto requestedStart = reinterpret_cast<uintptr_t>(ptr);
+    const auto requestedEnd = requestedStart + size;
+
+    for (auto &[bucket, mappedPtrsIndex] : mappedPtrsIndices) {
+        // ranges in this bucket are shorter than 2^(bucket + 1), so only ranges starting
+        // that close below requested end can contain it
+        const auto maxMappedPtrLength = (static_cast<uint64_t>(2u) << bucket) - 1;
+
+        auto it = mappedPtrsIndex.upper_bound(requestedStart);
+        while (it != mappedPtrsIndex.begin()) {
+            --it;
+            const auto mappedStart = it->first;
+            if (requestedEnd - mappedStart > maxMappedPtrLength) {
+                break;
+            }
+            const auto &mapInfo = it->second.second;
+            if (requestedEnd <= mappedStart + mapInfo.ptrLength) {
+                outInfo = mapInfo;
+                return true;
+            }
         }
     }
     return false;
@@ -117,5 +149,33 @@ bool NEO::MapOperationsStorage::getInfoForHostPtr(const void *ptr, size_t size,
 void NEO::MapOperationsStorage::removeHandler(cl_mem memObj) {
     std::lock_guard<std::mutex> lock(mutex);
     auto iterator = handlers.find(memObj);
+    for (auto &mapInfo : iterator->second.mappedPointers) {
+        unregisterMappedPtr(&iterator->second, mapInfo);
+    }
     handlers.erase(iterator);
 }
+
+void NEO::MapOperationsStorage::registerMappedPtr(const MapOperationsHandler *handler, const MapInfo &mapInfo) {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    auto &mappedPtrsIndex = mappedPtrsIndices[getMappedPtrLengthBucket(mapInfo.ptrLength)];
+    mappedPtrsIndex.emplace(reinterpret_cast<uintptr_t>(mapInfo.ptr), std::make_pair(handler, mapInfo));
+}
+
+void NEO::MapOperationsStorage::unregisterMappedPtr(const MapOperationsHandler *handler, const MapInfo &mapInfo) {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    auto bucketIt = mappedPtrsIndices.find(getMappedPtrLengthBucket(mapInfo.ptrLength));
+    if (bucketIt == mappedPtrsIndices.end()) {
+        return;
+    }
+    auto &mappedPtrsIndex = bucketIt->second;
+    auto range = mappedPtrsIndex.equal_range(reinterpret_cast<uintptr_t>(mapInfo.ptr));
+    for (auto it = range.first; it != range.second; it++) {
+        if (it->second.first == handler && it->second.second.ptrLength == mapInfo.ptrLength) {
+            mappedPtrsIndex.erase(it);
+            break;
+        }
+    }
+    if (mappedPtrsIndex.empty()) {
+        mappedPtrsIndices.erase(bucketIt);
+    }
+}
@@ -8,11 +8,15 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <cstdint>
+#include <map>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace NEO {
+class MapOperationsStorage;
 
 class MapOperationsHandler {
   public:
@@ -25,8 +29,11 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    friend class MapOperationsStorage;
+
     bool isOverlapping(MapInfo &inputMapInfo);
     std::vector<MapInfo> mappedPointers;
+    MapOperationsStorage *storage = nullptr;
     mutable std::mutex mtx;
 };
 
@@ -39,9 +46,21 @@ class MapOperationsStorage {
     bool getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo);
     void removeHandler(cl_mem memObj);
 
+    void registerMappedPtr(const MapOperationsHandler *handler, const MapInfo &mapInfo);
+    void unregisterMappedPtr(const MapOperationsHandler *handler, const MapInfo &mapInfo);
+
   protected:
+    using MappedPtrsIndex = std::multimap<uintptr_t, std::pair<const MapOperationsHandler *, MapInfo>>;
+
     std::mutex mutex;
     HandlersMap handlers{};
+
+    static uint32_t getMappedPtrLengthBucket(size_t ptrLength);
+
+    // All mapped ranges of the context sorted by start address and bucketed by log2 of their length,
+    // so host pointer lookups only visit ranges which start close enough below the requested pointer.
+    std::mutex indexMutex;
+    std::map<uint32_t, MappedPtrsIndex> mappedPtrsIndices;
 };
 
 } // namespace NEO
@@ -8,6 +8,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -33,6 +34,32 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     UNRECOVERABLE_IF(allocData == nullptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferRangeToGpu(void *allocPtr, void *rangePtr, size_t rangeSize, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto &pageFaultData = memoryData[allocPtr];
+    auto unifiedMemoryManager = pageFaultData.unifiedMemoryManager;
+    UNRECOVERABLE_IF(pageFaultData.migrationChunkSize == 0u);
+
+    // Each chunk was mapped separately on CPU fault, drop those map operations so the whole range is unmapped at once
+    for (size_t chunkOffset = 0u; chunkOffset < rangeSize; chunkOffset += pageFaultData.migrationChunkSize) {
+        auto chunkPtr = ptrOffset(rangePtr, chunkOffset);
+        if (unifiedMemoryManager->getSvmMapOperation(chunkPtr)) {
+            unifiedMemoryManager->removeSvmMapOperation(chunkPtr);
+        }
+    }
+    unifiedMemoryManager->insertSvmMapOperation(rangePtr, rangeSize, allocPtr, ptrDiff(rangePtr, allocPtr), false);
+    auto retVal = commandQueue->enqueueSVMUnmap(rangePtr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = unifiedMemoryManager->getSVMAlloc(allocPtr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+bool PageFaultManager::isRangeMigrationSupported() {
+    return true;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     auto commandQueue = static_cast<CommandQueue *>(pageFaultData.cmdQ);
 
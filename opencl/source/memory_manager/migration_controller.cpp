@@ -50,6 +50,18 @@ void MigrationController::migrateMemory(Context &context, MemoryManager &memoryM
     auto dstMemory = multiGraphicsAllocation.getGraphicsAllocation(targetRootDeviceIndex);
 
     auto size = srcMemory->getUnderlyingBufferSize();
+
+    if (srcMemory->isAllocationLockable() && dstMemory->isAllocationLockable()) {
+        // both storages are CPU accessible, copy directly without bouncing through the host staging buffer
+        auto srcLockPtr = memoryManager.lockResource(srcMemory);
+        auto dstLockPtr = memoryManager.lockResource(dstMemory);
+        memcpy_s(dstLockPtr, size, srcLockPtr, size);
+        memoryManager.unlockResource(dstMemory);
+        memoryManager.unlockResource(srcMemory);
+        migrationSyncData->setCurrentLocation(targetRootDeviceIndex);
+        return;
+    }
+
     auto hostPtr = migrationSyncData->getHostPtr();
 
     if (srcMemory->isAllocationLockable()) {
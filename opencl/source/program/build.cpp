@@ -14,6 +14,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
 #include "shared/source/helpers/compiler_options_parser.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/utilities/logger.h"
 
@@ -30,6 +31,42 @@
 
 namespace NEO {
 
+bool Program::isBuildOutputShareable(const ClDevice &compiledClDevice, const ClDevice &clDevice) {
+    const auto &compiledHwInfo = compiledClDevice.getHardwareInfo();
+    const auto &hwInfo = clDevice.getHardwareInfo();
+    return compiledHwInfo.platform.eProductFamily == hwInfo.platform.eProductFamily &&
+           compiledHwInfo.platform.usDeviceID == hwInfo.platform.usDeviceID &&
+           compiledHwInfo.platform.usRevId == hwInfo.platform.usRevId &&
+           compiledHwInfo.ipVersion.value == hwInfo.ipVersion.value &&
+           compiledHwInfo.gtSystemInfo.SliceCount == hwInfo.gtSystemInfo.SliceCount &&
+           compiledHwInfo.gtSystemInfo.SubSliceCount == hwInfo.gtSystemInfo.SubSliceCount &&
+           compiledHwInfo.gtSystemInfo.EUCount == hwInfo.gtSystemInfo.EUCount &&
+           compiledHwInfo.featureTable.packed == hwInfo.featureTable.packed &&
+           compiledHwInfo.workaroundTable.packed == hwInfo.workaroundTable.packed &&
+           (compiledClDevice.getDevice().getDebugger() != nullptr) == (clDevice.getDevice().getDebugger() != nullptr);
+}
+
+void Program::reuseBuildOutput(const CompiledDeviceOutput &compiledDevice, const ClDevice &clDevice, std::unordered_map<uint32_t, BuildPhase> &phaseReached) {
+    auto rootDeviceIndex = clDevice.getRootDeviceIndex();
+    auto &srcBuildInfo = buildInfos[compiledDevice.clDevice->getRootDeviceIndex()];
+    auto &dstBuildInfo = buildInfos[rootDeviceIndex];
+
+    updateBuildLog(rootDeviceIndex, compiledDevice.frontendCompilerLog.c_str(), compiledDevice.frontendCompilerLog.size());
+    updateBuildLog(rootDeviceIndex, compiledDevice.backendCompilerLog.c_str(), compiledDevice.backendCompilerLog.size());
+
+    dstBuildInfo.debugData = srcBuildInfo.debugData ? makeCopy(srcBuildInfo.debugData.get(), srcBuildInfo.debugDataSize) : nullptr;
+    dstBuildInfo.debugDataSize = srcBuildInfo.debugDataSize;
+    if (BuildPhase::binaryCreation == phaseReached[rootDeviceIndex]) {
+        return;
+    }
+    if (srcBuildInfo.packedDeviceBinary) {
+        replaceDeviceBinary(makeCopy(srcBuildInfo.packedDeviceBinary.get(), srcBuildInfo.packedDeviceBinarySize), srcBuildInfo.packedDeviceBinarySize, rootDeviceIndex);
+    } else {
+        replaceDeviceBinary(makeCopy(srcBuildInfo.unpackedDeviceBinary.get(), srcBuildInfo.unpackedDeviceBinarySize), srcBuildInfo.unpackedDeviceBinarySize, rootDeviceIndex);
+    }
+    phaseReached[rootDeviceIndex] = BuildPhase::binaryCreation;
+}
+
 cl_int Program::build(
     const ClDeviceVector &deviceVector,
     const char *buildOptions) {
@@ -115,10 +152,18 @@ cl_int Program::build(
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
             NEO::TranslationOutput compilerOuput = {};
 
+            std::vector<CompiledDeviceOutput> compiledDevices;
             for (const auto &clDevice : deviceVector) {
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
                     this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
                 }
+                auto compiledDevice = std::find_if(compiledDevices.begin(), compiledDevices.end(), [&](const auto &compiled) {
+                    return isBuildOutputShareable(*compiled.clDevice, *clDevice);
+                });
+                if (compiledDevice != compiledDevices.end()) {
+                    reuseBuildOutput(*compiledDevice, *clDevice, phaseReached);
+                    continue;
+                }
                 auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
@@ -126,6 +171,7 @@ cl_int Program::build(
                 if (retVal != CL_SUCCESS) {
                     break;
                 }
+                compiledDevices.push_back({clDevice, compilerOuput.frontendCompilerLog, compilerOuput.backendCompilerLog});
                 if (inputArgs.srcType == IGC::CodeType::oclC) {
                     this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
                     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
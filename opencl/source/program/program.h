@@ -291,6 +291,14 @@ class Program : public BaseObject<_cl_program> {
     void updateNonUniformFlag();
     void updateNonUniformFlag(const Program **inputProgram, size_t numInputPrograms);
 
+    struct CompiledDeviceOutput {
+        const ClDevice *clDevice = nullptr;
+        std::string frontendCompilerLog;
+        std::string backendCompilerLog;
+    };
+    static bool isBuildOutputShareable(const ClDevice &compiledClDevice, const ClDevice &clDevice);
+    void reuseBuildOutput(const CompiledDeviceOutput &compiledDevice, const ClDevice &clDevice, std::unordered_map<uint32_t, BuildPhase> &phaseReached);
+
     void extractInternalOptions(const std::string &options, std::string &internalOptions);
     MOCKABLE_VIRTUAL bool isFlagOption(ConstStringRef option);
     MOCKABLE_VIRTUAL bool isOptionValueValid(ConstStringRef option, ConstStringRef value);
@@ -13,6 +13,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
@@ -181,6 +182,66 @@ HWTEST_F(EnqueueFillBufferCmdTests, GivenMiddleWhenFillingBufferThenFillBufferMi
     context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, GivenDwordPatternAndImmediateMiddleEnabledWhenFillingBufferThenFillBufferImmediateKernelUsedForMiddle) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateFillBufferMiddle.set(1);
+
+    auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), sizeof(uint32_t)});
+    uint32_t pattern = 0xabcd1234u;
+    memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(uint32_t), &pattern, sizeof(uint32_t));
+
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::fillBuffer,
+                                                                            pCmdQ->getClDevice());
+    ASSERT_NE(nullptr, &builder);
+
+    BuiltinOpParams dc;
+    MemObj patternMemObj(&this->context, 0, {}, 0, 0, sizeof(uint32_t), patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), GraphicsAllocationHelper::toMultiGraphicsAllocation(patternAllocation), false, false, true);
+    dc.srcMemObj = &patternMemObj;
+    dc.dstMemObj = buffer;
+    dc.dstOffset = {0, 0, 0};
+    dc.size = {MemoryConstants::cacheLineSize, 0, 0};
+
+    MultiDispatchInfo mdi(dc);
+    builder.buildDispatchInfos(mdi);
+    EXPECT_EQ(1u, mdi.size());
+
+    auto di = mdi.begin();
+    EXPECT_EQ(Vec3<size_t>(MemoryConstants::cacheLineSize / (4 * sizeof(uint32_t)), 1, 1), di->getGWS());
+    EXPECT_STREQ("FillBufferImmediate", di->getKernel()->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
+
+    context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, GivenPatternLargerThanDwordAndImmediateMiddleEnabledWhenFillingBufferThenFillBufferMiddleKernelUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateFillBufferMiddle.set(1);
+
+    constexpr size_t patternSize = 2 * sizeof(uint32_t);
+    auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), patternSize});
+
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::fillBuffer,
+                                                                            pCmdQ->getClDevice());
+    ASSERT_NE(nullptr, &builder);
+
+    BuiltinOpParams dc;
+    MemObj patternMemObj(&this->context, 0, {}, 0, 0, patternSize, patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), GraphicsAllocationHelper::toMultiGraphicsAllocation(patternAllocation), false, false, true);
+    dc.srcMemObj = &patternMemObj;
+    dc.dstMemObj = buffer;
+    dc.dstOffset = {0, 0, 0};
+    dc.size = {MemoryConstants::cacheLineSize, 0, 0};
+
+    MultiDispatchInfo mdi(dc);
+    builder.buildDispatchInfos(mdi);
+    EXPECT_EQ(1u, mdi.size());
+
+    auto kernel = mdi.begin()->getKernel();
+    EXPECT_STREQ("FillBufferMiddle", kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
+
+    context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
+}
+
 HWTEST_F(EnqueueFillBufferCmdTests, GivenLeftLeftoverWhenFillingBufferThenFillBufferLeftLeftoverKernelUsed) {
     auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), EnqueueFillBufferTraits::patternSize});
 
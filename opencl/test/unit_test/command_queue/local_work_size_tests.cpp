@@ -975,3 +975,75 @@ TEST_F(LocalWorkSizeTest, givenGwsWithSmallXAndBigYWhenLwsIsCalculatedThenDescen
     EXPECT_EQ(workGroupSize[1], 128u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST_F(LocalWorkSizeTest, givenKernelWhenLwsIsComputedThenResultIsCachedPerGwsSlmAndDim) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setGWS({256, 1, 1});
+    dispatchInfo.setDim(1);
+
+    auto &lwsCache = kernel.mockKernel->getLocalWorkSizeCache();
+    EXPECT_EQ(0u, lwsCache.size());
+
+    auto lws = computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(1u, lwsCache.size());
+
+    Vec3<size_t> cachedLws{0, 0, 0};
+    EXPECT_TRUE(lwsCache.find({{256, 1, 1}, kernel.mockKernel->getSlmTotalSize(), 1u,
+                               debugManager.flags.EnableComputeWorkSizeND.get(), debugManager.flags.EnableComputeWorkSizeSquared.get()},
+                              cachedLws));
+    EXPECT_EQ(lws, cachedLws);
+
+    EXPECT_EQ(lws, computeWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(1u, lwsCache.size());
+
+    dispatchInfo.setDim(2);
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, lwsCache.size());
+
+    dispatchInfo.setGWS({512, 1, 1});
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(3u, lwsCache.size());
+}
+
+TEST_F(LocalWorkSizeTest, givenLwsCacheEntryWhenComputingLwsThenCachedValueIsReturned) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setGWS({1024, 1, 1});
+    dispatchInfo.setDim(1);
+
+    kernel.mockKernel->getLocalWorkSizeCache().insert({{1024, 1, 1}, kernel.mockKernel->getSlmTotalSize(), 1u,
+                                                       debugManager.flags.EnableComputeWorkSizeND.get(), debugManager.flags.EnableComputeWorkSizeSquared.get()},
+                                                      Vec3<size_t>{4, 1, 1});
+    EXPECT_EQ(Vec3<size_t>(4, 1, 1), computeWorkgroupSize(dispatchInfo));
+}
+
+TEST_F(LocalWorkSizeTest, givenLwsCacheEntryWhenWorkSizeAlgorithmFlagsChangeThenLwsIsNotTakenFromCache) {
+    DebugManagerStateRestore restorer;
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setGWS({1024, 1024, 1});
+    dispatchInfo.setDim(2);
+
+    debugManager.flags.EnableComputeWorkSizeND.set(false);
+    debugManager.flags.EnableComputeWorkSizeSquared.set(false);
+    kernel.mockKernel->getLocalWorkSizeCache().insert({{1024, 1024, 1}, kernel.mockKernel->getSlmTotalSize(), 2u, false, false}, Vec3<size_t>{4, 1, 1});
+    EXPECT_EQ(Vec3<size_t>(4, 1, 1), computeWorkgroupSize(dispatchInfo));
+
+    debugManager.flags.EnableComputeWorkSizeSquared.set(true);
+    EXPECT_NE(Vec3<size_t>(4, 1, 1), computeWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(2u, kernel.mockKernel->getLocalWorkSizeCache().size());
+
+    debugManager.flags.EnableComputeWorkSizeND.set(true);
+    EXPECT_NE(Vec3<size_t>(4, 1, 1), computeWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(3u, kernel.mockKernel->getLocalWorkSizeCache().size());
+}
@@ -341,3 +341,78 @@ TEST(ReadWriteBufferOnCpu, whenLocalMemoryPoolAllocationIsAskedForPreferenceThen
     EXPECT_FALSE(buffer->isReadWriteOnCpuAllowed(device->getDevice()));
     EXPECT_FALSE(buffer->isReadWriteOnCpuPreferred(reinterpret_cast<void *>(0x1000), MemoryConstants::pageSize, device->getDevice()));
 }
+
+TEST(ReadWriteBufferOnCpu, givenCpuCopyThroughLockEnabledWhenLocalMemoryBufferIsAccessedWithSmallBlockingTransferThenCpuCopyIsAllowed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::defaultMode));
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+
+    cl_int retVal = 0;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&ctx, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer.get());
+    reinterpret_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(device->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::localMemory);
+    auto mockCommandQueue = std::make_unique<MockCommandQueue>(ctx);
+
+    EXPECT_FALSE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_READ_BUFFER, 64u, device->getDevice()));
+
+    debugManager.flags.DoCpuCopyThroughLockOnReadWriteBuffer.set(1);
+    EXPECT_TRUE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_READ_BUFFER, Buffer::maxReadSizeThroughLockedPtr, device->getDevice()));
+    EXPECT_FALSE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_READ_BUFFER, Buffer::maxReadSizeThroughLockedPtr + 1, device->getDevice()));
+    EXPECT_TRUE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_WRITE_BUFFER, Buffer::maxReadSizeThroughLockedPtr + 1, device->getDevice()));
+
+    debugManager.flags.ExperimentalD2HCpuCopyThreshold.set(MemoryConstants::pageSize);
+    EXPECT_TRUE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_READ_BUFFER, MemoryConstants::pageSize, device->getDevice()));
+
+    EXPECT_TRUE(mockCommandQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_READ_BUFFER, CL_TRUE, 64u, reinterpret_cast<void *>(0x1000), 0u, nullptr));
+    EXPECT_TRUE(mockCommandQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_WRITE_BUFFER, CL_TRUE, 64u, reinterpret_cast<void *>(0x1000), 0u, nullptr));
+    EXPECT_FALSE(mockCommandQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_READ_BUFFER, CL_FALSE, 64u, reinterpret_cast<void *>(0x1000), 0u, nullptr));
+
+    buffer->forceDisallowCPUCopy = true;
+    EXPECT_FALSE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_READ_BUFFER, 64u, device->getDevice()));
+}
+
+TEST(ReadWriteBufferOnCpu, givenCpuCopyThroughLockEnabledWhenBufferRequiresMigrationsThenLockedPtrIsNotPreferred) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::defaultMode));
+    debugManager.flags.DoCpuCopyThroughLockOnReadWriteBuffer.set(1);
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+
+    cl_int retVal = 0;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&ctx, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer.get());
+    reinterpret_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(device->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::localMemory);
+    auto mockCommandQueue = std::make_unique<MockCommandQueue>(ctx);
+
+    EXPECT_TRUE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_WRITE_BUFFER, 64u, device->getDevice()));
+
+    const_cast<MultiGraphicsAllocation &>(buffer->getMultiGraphicsAllocation()).setMultiStorage(true);
+    ASSERT_TRUE(buffer->getMultiGraphicsAllocation().requiresMigrations());
+
+    EXPECT_FALSE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_WRITE_BUFFER, 64u, device->getDevice()));
+    EXPECT_FALSE(mockCommandQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_WRITE_BUFFER, CL_TRUE, 64u, reinterpret_cast<void *>(0x1000), 0u, nullptr));
+}
+
+TEST(ReadWriteBufferOnCpu, givenCpuCopyThroughLockEnabledWhenLockingBufferFailsThenCpuCopyIsNotAllowed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::defaultMode));
+    debugManager.flags.DoCpuCopyThroughLockOnReadWriteBuffer.set(1);
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+
+    cl_int retVal = 0;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&ctx, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer.get());
+    reinterpret_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(device->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::localMemory);
+    auto mockCommandQueue = std::make_unique<MockCommandQueue>(ctx);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getMemoryManager());
+    memoryManager->failLockResource = true;
+
+    EXPECT_TRUE(buffer->isReadWriteThroughLockedPtrPreferred(CL_COMMAND_WRITE_BUFFER, 64u, device->getDevice()));
+    EXPECT_FALSE(mockCommandQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_WRITE_BUFFER, CL_TRUE, 64u, reinterpret_cast<void *>(0x1000), 0u, nullptr));
+
+    memoryManager->failLockResource = false;
+    EXPECT_TRUE(mockCommandQueue->bufferCpuCopyAllowed(buffer.get(), CL_COMMAND_WRITE_BUFFER, CL_TRUE, 64u, reinterpret_cast<void *>(0x1000), 0u, nullptr));
+}
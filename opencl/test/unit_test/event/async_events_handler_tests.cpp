@@ -45,7 +45,13 @@ class AsyncEventsHandlerTests : public ::testing::Test {
             return waitResult;
         }
 
+        void updateExecutionStatus() override {
+            updateExecutionStatusCalled++;
+            Event::updateExecutionStatus();
+        }
+
         uint32_t waitCalled = 0u;
+        uint32_t updateExecutionStatusCalled = 0u;
         WaitStatus waitResult = WaitStatus::ready;
         std::unique_ptr<MockHandler> handler;
     };
@@ -311,6 +317,23 @@ TEST_F(AsyncEventsHandlerTests, givenUserEventWhenCallbackIsAddedThenDontRegiste
     userEvent.decRefInternal();
 }
 
+TEST_F(AsyncEventsHandlerTests, givenRegisteredBlockedEventWhenItsStatusChangesThenHandlerIsNotified) {
+    debugManager.flags.EnableAsyncEventsHandler.set(true);
+    auto myHandler = new MockHandler();
+    context->getAsyncEventsHandlerUniquePtr().reset(myHandler);
+
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    EXPECT_TRUE(myHandler->openThreadCalled);
+    EXPECT_FALSE(myHandler->eventsUpdated);
+
+    event1->setStatus(CL_SUBMITTED);
+    EXPECT_TRUE(event1->peekHasCallbacks());
+    EXPECT_TRUE(myHandler->eventsUpdated);
+
+    event1->setStatus(CL_COMPLETE);
+    EXPECT_EQ(1, counter);
+}
+
 TEST_F(AsyncEventsHandlerTests, givenRegistredEventsWhenProcessIsCalledThenReturnCandidateWithLowestTaskCount) {
     int event1Counter(0), event2Counter(0), event3Counter(0);
 
@@ -333,6 +356,51 @@ TEST_F(AsyncEventsHandlerTests, givenRegistredEventsWhenProcessIsCalledThenRetur
     event3->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsOfSameCsrWhenEarlierEventIsNotCompletedThenLaterEventsAreNotUpdated) {
+    int event1Counter(0), event2Counter(0);
+
+    event1->setTaskStamp(0, 1);
+    event2->setTaskStamp(0, 2);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event1.get());
+    handler->registerEvent(event2.get());
+
+    handler->process();
+    EXPECT_EQ(CL_SUBMITTED, event1->getExecutionStatus());
+    EXPECT_EQ(CL_SUBMITTED, event2->getExecutionStatus());
+    EXPECT_EQ(1u, event1->updateExecutionStatusCalled);
+    EXPECT_EQ(1u, event2->updateExecutionStatusCalled);
+
+    handler->process();
+    EXPECT_EQ(2u, event1->updateExecutionStatusCalled);
+    EXPECT_EQ(1u, event2->updateExecutionStatusCalled);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 2;
+    handler->process();
+    EXPECT_EQ(3u, event1->updateExecutionStatusCalled);
+    EXPECT_EQ(2u, event2->updateExecutionStatusCalled);
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenSkippedEventWithoutCallbacksWhenProcessedThenItIsNotKeptPending) {
+    event1->setTaskStamp(0, 1);
+    event2->setTaskStamp(0, 2);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+    handler->registerEvent(event2.get());
+
+    handler->process();
+    EXPECT_EQ(0u, event2->updateExecutionStatusCalled);
+    ASSERT_EQ(1u, handler->list.size());
+    EXPECT_EQ(event1.get(), handler->list[0]);
+
+    event1->setStatus(CL_COMPLETE);
+}
+
 TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontReturnAsSleepCandidate) {
     event1->setTaskStamp(0, 1);
     event2->setTaskStamp(0, 2);
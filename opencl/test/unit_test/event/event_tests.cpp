@@ -161,6 +161,24 @@ TEST(Event, givenBcsCsrSetInEventWhenPeekingBcsTaskCountThenReturnCorrectTaskCou
     EXPECT_EQ(19u, event.peekBcsTaskCountFromCommandQueue());
 }
 
+TEST(Event, givenBcsCsrSetInEventWhenGettingCsrForOrderedCompletionCheckThenNullptrIsReturned) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+
+    auto device = ReleaseableObjectPtr<MockClDevice>{
+        new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockAlignedMallocManagerDevice>(&hwInfo)}};
+
+    REQUIRE_FULL_BLITTER_OR_SKIP(device->getRootDeviceEnvironment());
+
+    MockContext context{device.get()};
+    MockCommandQueue queue{context};
+    queue.constructBcsEngine(false);
+    Event event{&queue, CL_COMMAND_READ_BUFFER, 0, 0};
+
+    event.setupBcs(queue.bcsEngines[0]->getEngineType());
+    EXPECT_EQ(nullptr, event.getCsrForOrderedCompletionCheck());
+}
+
 TEST(Event, givenCommandQueueWhenEventIsCreatedWithCommandQueueThenCommandQueueInternalRefCountIsIncremented) {
     auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
     MockContext ctx;
@@ -639,6 +639,49 @@ TEST_F(KernelArgBufferTest, givenSVMAllocsManagerWithCompressedSVMAllocationsWhe
     }
 }
 
+TEST_F(KernelArgBufferTest, givenSkipAuxTranslationOfUnreachableAllocationsWhenKernelCannotAccessIndirectAllocationsThenCompressedSVMAllocationIsNotTranslatedUnlessPassedAsSvmPtr) {
+    if (pContext->getSVMAllocsManager() == nullptr) {
+        return;
+    }
+
+    DebugManagerStateRestore debugRestorer;
+    debugManager.flags.EnableStatelessCompression.set(1);
+    debugManager.flags.SkipAuxTranslationOfUnreachableAllocations.set(1);
+
+    GmmRequirements gmmRequirements{};
+    gmmRequirements.allowLargePages = true;
+    gmmRequirements.preferCompressed = false;
+    auto gmm = std::make_unique<Gmm>(pDevice->getRootDeviceEnvironment().getGmmHelper(), nullptr, 0, 0, GMM_RESOURCE_USAGE_OCL_BUFFER, StorageInfo{}, gmmRequirements);
+    gmm->setCompressionEnabled(true);
+
+    MockGraphicsAllocation gfxAllocation;
+    gfxAllocation.setDefaultGmm(gmm.get());
+    gfxAllocation.setAllocationType(AllocationType::svmGpu);
+
+    SvmAllocationData allocData(0);
+    allocData.gpuAllocations.addAllocation(&gfxAllocation);
+    allocData.device = &pClDevice->getDevice();
+    pContext->getSVMAllocsManager()->insertSVMAlloc(allocData);
+
+    EXPECT_FALSE(pKernel->canAccessIndirectAllocations());
+    auto kernelObjsForAuxTranslation = pKernel->fillWithKernelObjsForAuxTranslation();
+    EXPECT_EQ(0u, kernelObjsForAuxTranslation->size());
+    EXPECT_EQ(1u, pKernel->getAuxTranslationsAvoidedCount());
+
+    pKernel->kernelSvmGfxAllocations.push_back(&gfxAllocation);
+    kernelObjsForAuxTranslation = pKernel->fillWithKernelObjsForAuxTranslation();
+    EXPECT_EQ(1u, kernelObjsForAuxTranslation->size());
+    pKernel->kernelSvmGfxAllocations.clear();
+
+    pKernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
+    EXPECT_TRUE(pKernel->canAccessIndirectAllocations());
+    kernelObjsForAuxTranslation = pKernel->fillWithKernelObjsForAuxTranslation();
+    EXPECT_EQ(1u, kernelObjsForAuxTranslation->size());
+    EXPECT_EQ(1u, pKernel->getAuxTranslationsAvoidedCount());
+
+    pContext->getSVMAllocsManager()->removeSVMAlloc(allocData);
+}
+
 class KernelArgBufferFixtureBindless : public KernelArgBufferFixture {
   public:
     void setUp() {
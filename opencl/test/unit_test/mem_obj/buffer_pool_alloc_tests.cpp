@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 #include "shared/source/utilities/heap_allocator.h"
@@ -227,6 +228,87 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
     EXPECT_EQ(PoolAllocator::chunkAlignment, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
 }
 
+TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeWithinSmallTierThresholdWhenRegularPoolHasSpaceThenSmallTierPoolIsUsed) {
+    poolAllocator->maxPoolCount = 2u;
+    size = PoolAllocator::smallTierBufferThreshold / 2 + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(buffer, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(poolAllocator->isPoolBuffer(buffer->getAssociatedMemObject()));
+
+    ASSERT_EQ(1u, poolAllocator->smallTierBufferPools.size());
+    EXPECT_EQ(alignUp(size, PoolAllocator::smallTierChunkAlignment), poolAllocator->smallTierBufferPools[0].chunkAllocator->getUsedSize());
+    EXPECT_EQ(0u, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeWithinSmallTierThresholdWhenMaxPoolCountIsReachedThenRegularPoolIsUsed) {
+    poolAllocator->maxPoolCount = 1u;
+    size = PoolAllocator::smallTierBufferThreshold / 2 + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(buffer, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(poolAllocator->isPoolBuffer(buffer->getAssociatedMemObject()));
+
+    EXPECT_EQ(0u, poolAllocator->smallTierBufferPools.size());
+    EXPECT_EQ(PoolAllocator::chunkAlignment, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeWithinSmallTierThresholdWhenRegularPoolsAreFullThenSmallTierPoolWithPageGranularityIsUsed) {
+    poolAllocator->maxPoolCount = 2u;
+    constexpr auto regularBuffersCount = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::chunkAlignment;
+    std::vector<std::unique_ptr<Buffer>> regularBuffers;
+    for (auto i = 0u; i < regularBuffersCount; i++) {
+        regularBuffers.emplace_back(Buffer::create(context.get(), flags, PoolAllocator::chunkAlignment, hostPtr, retVal));
+    }
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(0u, poolAllocator->smallTierBufferPools.size());
+
+    size = PoolAllocator::smallTierBufferThreshold / 2 + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(buffer, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(size, buffer->getSize());
+
+    ASSERT_EQ(1u, poolAllocator->smallTierBufferPools.size());
+    EXPECT_TRUE(poolAllocator->isPoolBuffer(buffer->getAssociatedMemObject()));
+
+    const auto expectedChunkSize = alignUp(size, PoolAllocator::smallTierChunkAlignment);
+    EXPECT_EQ(expectedChunkSize, poolAllocator->smallTierBufferPools[0].chunkAllocator->getUsedSize());
+    auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
+    EXPECT_EQ(expectedChunkSize, mockBuffer->sizeInPoolAllocator);
+    EXPECT_EQ(0u, mockBuffer->getOffset() % PoolAllocator::smallTierChunkAlignment);
+
+    buffer.reset(nullptr);
+    EXPECT_EQ(1u, poolAllocator->smallTierBufferPools[0].chunksToFree.size());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledWhenMaxPoolCountIsReachedByRegularPoolsThenSmallTierPoolIsNotCreated) {
+    poolAllocator->maxPoolCount = 1u;
+    constexpr auto regularBuffersCount = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::chunkAlignment;
+    std::vector<std::unique_ptr<Buffer>> regularBuffers;
+    for (auto i = 0u; i < regularBuffersCount; i++) {
+        regularBuffers.emplace_back(Buffer::create(context.get(), flags, PoolAllocator::chunkAlignment, hostPtr, retVal));
+    }
+
+    size = PoolAllocator::smallTierBufferThreshold;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(buffer, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(poolAllocator->isPoolBuffer(buffer->getAssociatedMemObject()));
+    EXPECT_EQ(1u, poolAllocator->bufferPools.size());
+    EXPECT_EQ(0u, poolAllocator->smallTierBufferPools.size());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeAboveSmallTierThresholdWhenBufferCreatedThenRegularPoolIsUsed) {
+    size = PoolAllocator::smallTierBufferThreshold + 1;
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_NE(buffer, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(0u, poolAllocator->smallTierBufferPools.size());
+    EXPECT_EQ(PoolAllocator::chunkAlignment, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+}
+
 TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledThenUsePool) {
     EXPECT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled(context.get()));
     EXPECT_EQ(1u, poolAllocator->bufferPools.size());
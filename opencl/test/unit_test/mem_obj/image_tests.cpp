@@ -1460,6 +1460,90 @@ TEST(ImageTest, givenClMemCopyHostPointerPassedToImageCreateWhenAllocationIsNotI
     EXPECT_LT(taskCount, taskCountSent);
 }
 
+TEST(ImageTest, givenCpuTiledImageTransferEnabledWhenCreatingSmallTiledImageWithCopyHostPtrThenImageIsWrittenByGmmCpuBlt) {
+    REQUIRE_IMAGES_OR_SKIP(defaultHwInfo);
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(64);
+
+    MockContext context;
+    auto &csr = context.getDevice(0)->getGpgpuCommandStreamReceiver();
+    auto taskCount = csr.peekLatestFlushedTaskCount();
+
+    char memory[16] = {};
+    cl_int retVal = CL_SUCCESS;
+    cl_mem_flags flags = CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR;
+
+    cl_image_desc imageDesc{};
+    imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imageDesc.image_width = 4;
+    imageDesc.image_height = 4;
+
+    cl_image_format imageFormat = {};
+    imageFormat.image_channel_data_type = CL_UNSIGNED_INT8;
+    imageFormat.image_channel_order = CL_R;
+    auto surfaceFormat = Image::getSurfaceFormatFromTable(
+        flags, &imageFormat, context.getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features);
+
+    std::unique_ptr<Image> image(
+        Image::create(&context, ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context.getDevice(0)->getDevice()),
+                      flags, 0, surfaceFormat, &imageDesc, memory, retVal));
+    ASSERT_NE(nullptr, image);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto allocation = image->getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex());
+    auto gmm = allocation->getDefaultGmm();
+    if (!image->isTiledAllocation() || gmm->isCompressionEnabled() || !allocation->isAllocationLockable()) {
+        GTEST_SKIP();
+    }
+
+    auto mockResourceInfo = static_cast<MockGmmResourceInfo *>(gmm->gmmResourceInfo.get());
+    EXPECT_EQ(1u, mockResourceInfo->cpuBltCalled);
+    EXPECT_EQ(taskCount, csr.peekLatestFlushedTaskCount());
+}
+
+TEST(ImageTest, givenCpuTiledImageTransferEnabledAndLockFailsWhenCreatingSmallTiledImageWithCopyHostPtrThenImageIsWrittenOnGpu) {
+    REQUIRE_IMAGES_OR_SKIP(defaultHwInfo);
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(64);
+
+    MockContext context;
+    auto memoryManager = static_cast<MockMemoryManager *>(context.getMemoryManager());
+    memoryManager->failLockResource = true;
+    auto &csr = context.getDevice(0)->getGpgpuCommandStreamReceiver();
+    auto taskCount = csr.peekLatestFlushedTaskCount();
+
+    char memory[16] = {};
+    cl_int retVal = CL_SUCCESS;
+    cl_mem_flags flags = CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR;
+
+    cl_image_desc imageDesc{};
+    imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imageDesc.image_width = 4;
+    imageDesc.image_height = 4;
+
+    cl_image_format imageFormat = {};
+    imageFormat.image_channel_data_type = CL_UNSIGNED_INT8;
+    imageFormat.image_channel_order = CL_R;
+    auto surfaceFormat = Image::getSurfaceFormatFromTable(
+        flags, &imageFormat, context.getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features);
+
+    std::unique_ptr<Image> image(
+        Image::create(&context, ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context.getDevice(0)->getDevice()),
+                      flags, 0, surfaceFormat, &imageDesc, memory, retVal));
+    ASSERT_NE(nullptr, image);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto allocation = image->getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex());
+    auto gmm = allocation->getDefaultGmm();
+    if (!image->isTiledAllocation() || gmm->isCompressionEnabled() || !allocation->isAllocationLockable()) {
+        GTEST_SKIP();
+    }
+
+    auto mockResourceInfo = static_cast<MockGmmResourceInfo *>(gmm->gmmResourceInfo.get());
+    EXPECT_EQ(0u, mockResourceInfo->cpuBltCalled);
+    EXPECT_LT(taskCount, csr.peekLatestFlushedTaskCount());
+}
+
 struct ImageConvertTypeTest
     : public ::testing::Test {
 
@@ -171,6 +171,7 @@ INSTANTIATE_TEST_SUITE_P(MapOperationsHandlerOverlapTests,
 
 struct MapOperationsStorageWhitebox : MapOperationsStorage {
     using MapOperationsStorage::handlers;
+    using MapOperationsStorage::mappedPtrsIndices;
 };
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThenCreateHandler) {
@@ -221,3 +222,84 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     storage.removeHandler(&buffer);
     EXPECT_EQ(0u, storage.handlers.size());
 }
+
+TEST(MapOperationsStorageTest, givenMappedPtrsInMultipleHandlersWhenGettingInfoForHostPtrThenReturnContainingMapping) {
+    MockBuffer buffer1{};
+    MockBuffer buffer2{};
+    MapOperationsStorageWhitebox storage{};
+    cl_map_flags mapFlags = CL_MAP_READ;
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+
+    EXPECT_TRUE(storage.getHandler(&buffer1).add(reinterpret_cast<void *>(0x1000), 0x1000, mapFlags, size, offset, 0, nullptr));
+    EXPECT_TRUE(storage.getHandler(&buffer2).add(reinterpret_cast<void *>(0x1800), 0x10, mapFlags, size, offset, 0, nullptr));
+    EXPECT_TRUE(storage.getHandler(&buffer2).add(reinterpret_cast<void *>(0x4000), 0x100, mapFlags, size, offset, 0, nullptr));
+
+    MapInfo outInfo{};
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1900), 0x100, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x1000), outInfo.ptr);
+
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x4010), 0x10, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x4000), outInfo.ptr);
+
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1f00), 0x200, outInfo));
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x3000), 0x10, outInfo));
+
+    storage.getHandler(&buffer1).remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1900), 0x100, outInfo));
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1804), 0x4, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x1800), outInfo.ptr);
+
+    storage.removeHandler(&buffer2);
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1804), 0x4, outInfo));
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x4010), 0x10, outInfo));
+}
+
+TEST(MapOperationsStorageTest, givenMappedPtrsOfDifferentLengthsWhenRemovingThemThenEmptyLengthBucketsAreReleased) {
+    MockBuffer buffer{};
+    MapOperationsStorageWhitebox storage{};
+    cl_map_flags mapFlags = CL_MAP_READ;
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+
+    auto &handler = storage.getHandler(&buffer);
+    EXPECT_TRUE(handler.add(reinterpret_cast<void *>(0x1000), 0x10000, mapFlags, size, offset, 0, nullptr));
+    EXPECT_TRUE(handler.add(reinterpret_cast<void *>(0x20000), 0x100, mapFlags, size, offset, 0, nullptr));
+    EXPECT_EQ(2u, storage.mappedPtrsIndices.size());
+
+    handler.remove(reinterpret_cast<void *>(0x1000));
+    EXPECT_EQ(1u, storage.mappedPtrsIndices.size());
+
+    MapInfo outInfo{};
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x20010), 0x10, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x20000), outInfo.ptr);
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x2000), 0x10, outInfo));
+
+    handler.remove(reinterpret_cast<void *>(0x20000));
+    EXPECT_TRUE(storage.mappedPtrsIndices.empty());
+}
+
+TEST(MapOperationsStorageTest, givenLongMappedPtrAmongManyShortOnesWhenGettingInfoForHostPtrThenContainingMappingIsReturned) {
+    MockBuffer longBuffer{};
+    MockBuffer shortBuffer{};
+    MapOperationsStorageWhitebox storage{};
+    cl_map_flags mapFlags = CL_MAP_READ;
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+
+    EXPECT_TRUE(storage.getHandler(&longBuffer).add(reinterpret_cast<void *>(0x100000), 0x100000, mapFlags, size, offset, 0, nullptr));
+    auto &shortHandler = storage.getHandler(&shortBuffer);
+    for (uintptr_t shortPtr = 0x100000; shortPtr < 0x1f0000; shortPtr += 0x1000) {
+        EXPECT_TRUE(shortHandler.add(reinterpret_cast<void *>(shortPtr), 0x10, mapFlags, size, offset, 0, nullptr));
+    }
+    EXPECT_EQ(2u, storage.mappedPtrsIndices.size());
+
+    MapInfo outInfo{};
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1f8000), 0x100, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x100000), outInfo.ptr);
+
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1ef004), 0x4, outInfo));
+    EXPECT_EQ(0x10u, outInfo.ptrLength);
+
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1ff000), 0x2000, outInfo));
+}
@@ -5,8 +5,10 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
@@ -17,6 +19,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <vector>
+
 using namespace NEO;
 
 struct CommandQueueMock : public MockCommandQueue {
@@ -136,3 +141,104 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenAllowCPUMemoryEvictionIs
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+struct MapOperationsTrackingCommandQueueMock : public MockCommandQueue {
+    // Emulates SVM map/unmap of CommandQueueHw: map copies device storage to CPU unless region is already mapped,
+    // unmap copies back the region recorded by the map operation found at given pointer
+    cl_int enqueueSVMMap(cl_bool blockingMap, cl_map_flags mapFlags,
+                         void *svmPtr, size_t size,
+                         cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                         cl_event *event, bool externalAppCall) override {
+        if (svmAllocsManager->getSvmMapOperation(svmPtr) == nullptr) {
+            auto offset = ptrDiff(svmPtr, svmBasePtr);
+            memcpy(svmPtr, deviceStorage.data() + offset, size);
+            svmAllocsManager->insertSvmMapOperation(svmPtr, size, svmBasePtr, offset, false);
+        }
+        return CL_SUCCESS;
+    }
+    cl_int enqueueSVMUnmap(void *svmPtr,
+                           cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                           cl_event *event, bool externalAppCall) override {
+        auto svmOperation = svmAllocsManager->getSvmMapOperation(svmPtr);
+        if (svmOperation) {
+            memcpy(deviceStorage.data() + svmOperation->offset, svmPtr, svmOperation->regionSize);
+            svmAllocsManager->removeSvmMapOperation(svmPtr);
+        }
+        return CL_SUCCESS;
+    }
+    cl_int finish() override {
+        return CL_SUCCESS;
+    }
+
+    SVMAllocsManager *svmAllocsManager = nullptr;
+    void *svmBasePtr = nullptr;
+    std::vector<char> deviceStorage;
+};
+
+class MemorySyncPageFaultManager : public MockPageFaultManager {
+  public:
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+        PageFaultManager::transferToCpu(ptr, size, cmdQ);
+    }
+    void transferRangeToGpu(void *allocPtr, void *rangePtr, size_t rangeSize, void *cmdQ) override {
+        PageFaultManager::transferRangeToGpu(allocPtr, rangePtr, rangeSize, cmdQ);
+    }
+};
+
+TEST_F(PageFaultManagerTest, givenChunksMappedSeparatelyOnCpuFaultsWhenCoalescedRangeIsMigratedToGpuThenDataOfEveryChunkIsTransferredAndNoMapOperationIsLeft) {
+    MockExecutionEnvironment executionEnvironment;
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(4);
+    constexpr size_t chunkSize = 4 * MemoryConstants::kiloByte;
+    constexpr size_t allocSize = 4 * chunkSize;
+
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    void *alloc = svmAllocsManager->createSVMAlloc(allocSize, {}, rootDeviceIndices, deviceBitfields);
+
+    auto cmdQ = std::make_unique<MapOperationsTrackingCommandQueueMock>();
+    cmdQ->device = device.get();
+    cmdQ->svmAllocsManager = svmAllocsManager.get();
+    cmdQ->svmBasePtr = alloc;
+    cmdQ->deviceStorage.assign(allocSize, 0);
+
+    auto memorySyncPageFaultManager = std::make_unique<MemorySyncPageFaultManager>();
+    memorySyncPageFaultManager->rangeMigrationSupported = true;
+    memorySyncPageFaultManager->gpuDomainHandler = &MockPageFaultManager::transferAndUnprotectMemory;
+    memorySyncPageFaultManager->insertAllocation(alloc, allocSize, svmAllocsManager.get(), cmdQ.get(), {});
+    ASSERT_EQ(chunkSize, memorySyncPageFaultManager->memoryData[alloc].migrationChunkSize);
+    memorySyncPageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    for (auto chunk : {1u, 2u}) {
+        auto chunkPtr = ptrOffset(alloc, chunk * chunkSize);
+        EXPECT_TRUE(memorySyncPageFaultManager->verifyPageFault(chunkPtr));
+        EXPECT_NE(nullptr, svmAllocsManager->getSvmMapOperation(chunkPtr));
+        memset(chunkPtr, static_cast<int>(chunk), chunkSize);
+    }
+
+    memorySyncPageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    for (auto chunk = 0u; chunk < 4u; chunk++) {
+        const char expectedValue = (chunk == 1u || chunk == 2u) ? static_cast<char>(chunk) : 0;
+        const std::vector<char> expectedData(chunkSize, expectedValue);
+        EXPECT_EQ(0, memcmp(expectedData.data(), cmdQ->deviceStorage.data() + chunk * chunkSize, chunkSize)) << "chunk " << chunk;
+        EXPECT_EQ(nullptr, svmAllocsManager->getSvmMapOperation(ptrOffset(alloc, chunk * chunkSize)));
+    }
+
+    auto chunk2Ptr = ptrOffset(alloc, 2 * chunkSize);
+    memset(chunk2Ptr, 0, chunkSize);
+    EXPECT_TRUE(memorySyncPageFaultManager->verifyPageFault(chunk2Ptr));
+    EXPECT_EQ(2, static_cast<char *>(chunk2Ptr)[0]);
+    EXPECT_EQ(2, static_cast<char *>(chunk2Ptr)[chunkSize - 1]);
+
+    memorySyncPageFaultManager->moveAllocationToGpuDomain(alloc);
+    memorySyncPageFaultManager->removeAllocation(alloc);
+    svmAllocsManager->freeSVMAlloc(alloc);
+    cmdQ->device = nullptr;
+}
@@ -151,6 +151,33 @@ HWTEST2_F(MigrationControllerTests, givenLockableBufferAllocationWithDefinedLoca
     EXPECT_EQ(0u, pCsr0->peekLatestFlushedTaskCount());
 }
 
+HWTEST2_F(MigrationControllerTests, givenLockableSourceAndDestinationAllocationsWhenHandleMigrationThenCopyDirectlyWithoutHostStagingBuffer, IsAtLeastGen12lp) {
+    std::unique_ptr<Buffer> pBuffer(BufferHelper<>::create(&context));
+    const_cast<MultiGraphicsAllocation &>(pBuffer->getMultiGraphicsAllocation()).setMultiStorage(true);
+
+    auto srcAllocation = pBuffer->getMultiGraphicsAllocation().getGraphicsAllocation(0);
+    auto dstAllocation = pBuffer->getMultiGraphicsAllocation().getGraphicsAllocation(1);
+    auto migrationSyncData = pBuffer->getMultiGraphicsAllocation().getMigrationSyncData();
+
+    auto size = srcAllocation->getUnderlyingBufferSize();
+    memset(srcAllocation->getUnderlyingBuffer(), 0xAB, size);
+    memset(dstAllocation->getUnderlyingBuffer(), 0, size);
+    memset(migrationSyncData->getHostPtr(), 0, size);
+
+    migrationSyncData->setCurrentLocation(0);
+    MigrationController::handleMigration(context, *pCsr1, pBuffer.get());
+    EXPECT_EQ(1u, migrationSyncData->getCurrentLocation());
+
+    EXPECT_EQ(2u, memoryManager->lockResourceCalled);
+    EXPECT_EQ(2u, memoryManager->unlockResourceCalled);
+    EXPECT_EQ(0, memcmp(srcAllocation->getUnderlyingBuffer(), dstAllocation->getUnderlyingBuffer(), size));
+
+    auto hostPtr = static_cast<uint8_t *>(migrationSyncData->getHostPtr());
+    for (size_t i = 0; i < size; i++) {
+        EXPECT_EQ(0u, hostPtr[i]);
+    }
+}
+
 HWTEST2_F(MigrationControllerTests, givenMultiGraphicsAllocationUsedInOneCsrWhenHandlingMigrationToOtherCsrOnTheSameRootDeviceThenDontWaitOnCpuForTheFirstCsrCompletion, IsAtLeastGen12lp) {
     VariableBackup<decltype(MultiGraphicsAllocation::createMigrationSyncDataFunc)> createFuncBackup{&MultiGraphicsAllocation::createMigrationSyncDataFunc};
     MultiGraphicsAllocation::createMigrationSyncDataFunc = [](size_t size) -> MigrationSyncData * {
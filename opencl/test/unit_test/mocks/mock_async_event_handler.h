@@ -23,6 +23,8 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::allowAsyncProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::eventsUpdated;
+    using AsyncEventsHandler::list;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
 
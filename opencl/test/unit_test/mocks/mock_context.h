@@ -59,6 +59,7 @@ class MockContext : public Context {
         using BufferPoolAllocator::calculateMaxPoolCount;
         using BufferPoolAllocator::isAggregatedSmallBuffersEnabled;
         using BufferPoolAllocator::maxPoolCount;
+        using BufferPoolAllocator::smallTierBufferPools;
     };
 
   private:
@@ -61,6 +61,7 @@ class MockProgram : public Program {
     using Program::internalOptionsToExtract;
     using Program::irBinary;
     using Program::irBinarySize;
+    using Program::isBuildOutputShareable;
     using Program::isBuiltIn;
     using Program::isCreatedFromBinary;
     using Program::isSpirV;
@@ -38,6 +38,7 @@
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_compiler_interface.h"
+#include "shared/test/common/mocks/mock_debugger.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_modules_zebin.h"
@@ -3246,6 +3247,61 @@ TEST_F(ProgramMultiRootDeviceTests, WhenProgramIsCreatedThenBuildInfosVectorIsPr
     }
 }
 
+TEST_F(ProgramMultiRootDeviceTests, givenRootDevicesWithSameHardwareWhenBuildingProgramThenCompileOnceAndShareDeviceBinary) {
+    struct MockCompilerInterfaceCountingBuilds : MockCompilerInterfaceCaptureBuildOptions {
+        TranslationOutput::ErrorCode build(const NEO::Device &device, const TranslationInput &input, TranslationOutput &out) override {
+            buildCalled++;
+            return MockCompilerInterfaceCaptureBuildOptions::build(device, input, out);
+        }
+        uint32_t buildCalled = 0u;
+    };
+    auto cip = new MockCompilerInterfaceCountingBuilds();
+    const char deviceBinary[] = "device binary";
+    cip->output.intermediateRepresentation.mem = makeCopy(deviceBinary, sizeof(deviceBinary));
+    cip->output.intermediateRepresentation.size = sizeof(deviceBinary);
+    device1->getExecutionEnvironment()->rootDeviceEnvironments[device1->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    const char *sources[] = {"some source code"};
+    size_t sourceSize = strlen(sources[0]);
+    cl_int retVal = CL_INVALID_PROGRAM;
+    auto program = Program::create<SucceedingGenBinaryProgram>(context.get(), 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, program);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = program->build(program->getDevices(), nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, cip->buildCalled);
+
+    for (auto &clDevice : {device1, device2}) {
+        auto &buildInfo = program->buildInfos[clDevice->getRootDeviceIndex()];
+        ASSERT_EQ(sizeof(deviceBinary), buildInfo.unpackedDeviceBinarySize);
+        EXPECT_EQ(0, memcmp(deviceBinary, buildInfo.unpackedDeviceBinary.get(), sizeof(deviceBinary)));
+    }
+    EXPECT_NE(program->buildInfos[device1->getRootDeviceIndex()].unpackedDeviceBinary.get(), program->buildInfos[device2->getRootDeviceIndex()].unpackedDeviceBinary.get());
+    program->release();
+}
+
+TEST_F(ProgramMultiRootDeviceTests, givenRootDevicesWithDifferentFeatureTableWorkaroundTableOrDebuggerStateThenBuildOutputIsNotShareable) {
+    EXPECT_TRUE(MockProgram::isBuildOutputShareable(*device1, *device2));
+
+    auto hwInfo = device2->getRootDeviceEnvironment().getMutableHardwareInfo();
+    auto featureTableBackup = hwInfo->featureTable;
+    hwInfo->featureTable.flags.ftrPooledEuEnabled = !hwInfo->featureTable.flags.ftrPooledEuEnabled;
+    EXPECT_FALSE(MockProgram::isBuildOutputShareable(*device1, *device2));
+    hwInfo->featureTable = featureTableBackup;
+
+    auto workaroundTableBackup = hwInfo->workaroundTable;
+    hwInfo->workaroundTable.flags.waCSRUncachable = !hwInfo->workaroundTable.flags.waCSRUncachable;
+    EXPECT_FALSE(MockProgram::isBuildOutputShareable(*device1, *device2));
+    hwInfo->workaroundTable = workaroundTableBackup;
+    EXPECT_TRUE(MockProgram::isBuildOutputShareable(*device1, *device2));
+
+    auto &debugger = device2->getExecutionEnvironment()->rootDeviceEnvironments[device2->getRootDeviceIndex()]->debugger;
+    debugger.reset(new MockDebugger());
+    EXPECT_FALSE(MockProgram::isBuildOutputShareable(*device1, *device2));
+    debugger.reset(nullptr);
+}
+
 class MockCompilerInterfaceWithGtpinParam : public CompilerInterface {
   public:
     TranslationOutput::ErrorCode link(
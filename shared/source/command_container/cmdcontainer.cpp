@@ -33,6 +33,9 @@ CommandContainer::~CommandContainer() {
         return;
     }
 
+    if (this->immediateCmdListCsr) {
+        storeAllocationsPendingSubmission(this->immediateCmdListCsr->peekTaskCount());
+    }
     this->handleCmdBufferAllocations(0u);
 
     if (heapHelper) {
@@ -321,6 +324,10 @@ void CommandContainer::handleCmdBufferAllocations(size_t startIndex) {
             this->device->getMemoryManager()->freeGraphicsMemory(cmdBufferAllocations[i]);
         }
     }
+    if (this->reusableAllocationList && debugManager.flags.ReusableCommandBufferPoolMaxSize.get() != -1) {
+        this->reusableAllocationList->trimToSize(static_cast<size_t>(debugManager.flags.ReusableCommandBufferPoolMaxSize.get()) * MemoryConstants::kiloByte,
+                                                 this->device->getMemoryManager());
+    }
 }
 
 GraphicsAllocation *CommandContainer::obtainNextCommandBufferAllocation() {
@@ -560,8 +567,28 @@ void CommandContainer::fillReusableAllocationLists() {
 }
 
 void CommandContainer::storeAllocationAndFlushTagUpdate(GraphicsAllocation *allocation) {
+    if (this->immediateCmdListSubmissionDeferred) {
+        // commands not submitted yet still use the allocation, it can be reused only after their submission completes
+        this->allocationsPendingSubmission.push_back(allocation);
+        return;
+    }
     auto lock = this->immediateCmdListCsr->obtainUniqueOwnership();
-    auto taskCount = this->immediateCmdListCsr->peekTaskCount() + 1;
+    storeReusableAllocation(allocation, this->immediateCmdListCsr->peekTaskCount() + 1);
+    this->immediateCmdListCsr->flushTagUpdate();
+}
+
+void CommandContainer::storeAllocationsPendingSubmission(TaskCountType taskCount) {
+    if (this->allocationsPendingSubmission.empty()) {
+        return;
+    }
+    auto lock = this->immediateCmdListCsr->obtainUniqueOwnership();
+    for (auto allocation : this->allocationsPendingSubmission) {
+        storeReusableAllocation(allocation, taskCount);
+    }
+    this->allocationsPendingSubmission.clear();
+}
+
+void CommandContainer::storeReusableAllocation(GraphicsAllocation *allocation, TaskCountType taskCount) {
     auto osContextId = this->immediateCmdListCsr->getOsContext().getContextId();
     allocation->updateTaskCount(taskCount, osContextId);
     allocation->updateResidencyTaskCount(taskCount, osContextId);
@@ -570,7 +597,6 @@ void CommandContainer::storeAllocationAndFlushTagUpdate(GraphicsAllocation *allo
     } else {
         getHeapHelper()->storeHeapAllocation(allocation);
     }
-    this->immediateCmdListCsr->flushTagUpdate();
 }
 
 HeapReserveData::HeapReserveData() {
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/heap_base_address_model.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
@@ -158,6 +159,9 @@ class CommandContainer : public NonCopyableOrMovableClass {
 
     void fillReusableAllocationLists();
     void storeAllocationAndFlushTagUpdate(GraphicsAllocation *allocation);
+    void storeAllocationsPendingSubmission(TaskCountType taskCount);
+    bool hasAllocationsPendingSubmission() const { return !allocationsPendingSubmission.empty(); }
+    void setImmediateCmdListSubmissionDeferred(bool deferred) { immediateCmdListSubmissionDeferred = deferred; }
 
     HeapReserveData &getSurfaceStateHeapReserve() {
         return surfaceStateHeapReserveData;
@@ -218,12 +222,14 @@ class CommandContainer : public NonCopyableOrMovableClass {
     inline bool skipHeapAllocationCreation(HeapType heapType);
     size_t getHeapSize(HeapType heapType);
     void alignPrimaryEnding(void *endPtr, size_t exactUsedSize);
+    void storeReusableAllocation(GraphicsAllocation *allocation, TaskCountType taskCount);
 
     GraphicsAllocation *allocationIndirectHeaps[HeapType::numTypes] = {};
 
     CmdBufferContainer cmdBufferAllocations;
     ResidencyContainer residencyContainer;
     std::vector<GraphicsAllocation *> deallocationContainer;
+    std::vector<GraphicsAllocation *> allocationsPendingSubmission;
     HeapContainer sshAllocations;
 
     HeapReserveData dynamicStateHeapReserveData;
@@ -270,6 +276,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     bool doubleSbaWa = false;
     bool usingPrimaryBuffer = false;
     bool globalBindlessHeapsEnabled = false;
+    bool immediateCmdListSubmissionDeferred = false;
 };
 
 } // namespace NEO
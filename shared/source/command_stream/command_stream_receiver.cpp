@@ -124,6 +124,7 @@ CommandStreamReceiver::~CommandStreamReceiver() {
 
     internalAllocationStorage->cleanAllocationList(-1, REUSABLE_ALLOCATION);
     internalAllocationStorage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
+    internalAllocationStorage->releaseHostPtrAllocationCache();
     internalAllocationStorage->cleanAllocationList(-1, DEFERRED_DEALLOCATION);
     getMemoryManager()->unregisterEngineForCsr(this);
 }
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/vec.h"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace NEO {
+
+struct LocalWorkSizeCacheKey {
+    Vec3<size_t> gws;
+    uint32_t slmTotalSize;
+    uint32_t workDim;
+    bool computeWorkSizeND;
+    bool computeWorkSizeSquared;
+
+    bool operator==(const LocalWorkSizeCacheKey &other) const {
+        return this->gws == other.gws && this->slmTotalSize == other.slmTotalSize && this->workDim == other.workDim &&
+               this->computeWorkSizeND == other.computeWorkSizeND && this->computeWorkSizeSquared == other.computeWorkSizeSquared;
+    }
+};
+
+struct LocalWorkSizeCacheKeyHash {
+    size_t operator()(const LocalWorkSizeCacheKey &key) const {
+        auto hash = std::hash<size_t>{};
+        size_t seed = hash(key.gws.x);
+        seed = hashCombine(seed, hash(key.gws.y));
+        seed = hashCombine(seed, hash(key.gws.z));
+        seed = hashCombine(seed, hash((static_cast<size_t>(key.slmTotalSize) << 4u) | (key.workDim << 2u) |
+                                      (static_cast<size_t>(key.computeWorkSizeND) << 1u) | static_cast<size_t>(key.computeWorkSizeSquared)));
+        return seed;
+    }
+
+    static size_t hashCombine(size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+    }
+};
+
+// Remembers local work sizes deduced by the driver for a given kernel, so that repeated
+// dispatches with the same global size do not redo the work group size search.
+// The key carries the work size algorithm selection, since it can change at runtime.
+class LocalWorkSizeCache {
+  public:
+    static constexpr size_t maxEntries = 1024u;
+
+    bool find(const LocalWorkSizeCacheKey &key, Vec3<size_t> &outLws) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            return false;
+        }
+        outLws = it->second;
+        return true;
+    }
+
+    void insert(const LocalWorkSizeCacheKey &key, const Vec3<size_t> &lws) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (entries.size() >= maxEntries) {
+            entries.clear();
+        }
+        entries.insert_or_assign(key, lws);
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return entries.size();
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        entries.clear();
+    }
+
+  protected:
+    std::unordered_map<LocalWorkSizeCacheKey, Vec3<size_t>, LocalWorkSizeCacheKeyHash> entries;
+    mutable std::mutex mtx;
+};
+
+} // namespace NEO
@@ -19,6 +19,7 @@
 #include "shared/source/helpers/timestamp_packet_container.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -61,6 +62,22 @@ class TimestampPackets : public TagTypeBase {
     uint64_t getGlobalEndValue(uint32_t packetIndex) const { return static_cast<uint64_t>(packets[packetIndex].globalEnd); }
 
     void const *getContextEndAddress(uint32_t packetIndex) const { return static_cast<void const *>(&packets[packetIndex].contextEnd); }
+
+    void updateGlobalBoundaryValues(uint32_t packetsUsed, uint64_t &globalStart, uint64_t &globalEnd) const {
+        for (uint32_t i = 0; i < packetsUsed; i++) {
+            globalStart = std::min(globalStart, static_cast<uint64_t>(packets[i].globalStart));
+            globalEnd = std::max(globalEnd, static_cast<uint64_t>(packets[i].globalEnd));
+        }
+    }
+
+    bool areAllPacketsCompleted(uint32_t packetsUsed) const {
+        for (uint32_t i = 0; i < packetsUsed; i++) {
+            if (packets[i].contextEnd == TimestampPacketConstants::initValue) {
+                return false;
+            }
+        }
+        return true;
+    }
     void const *getContextStartAddress(uint32_t packetIndex) const { return static_cast<void const *>(&packets[packetIndex].contextStart); }
 
   protected:
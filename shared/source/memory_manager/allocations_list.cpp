@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,37 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     return nullptr;
 }
 
+size_t AllocationsList::trimToSize(size_t maxTotalSize, MemoryManager *memoryManager) {
+    GraphicsAllocation *a = nullptr;
+    auto allocationsToRelease = processLocked<AllocationsList, &AllocationsList::detachAllocationsAboveSizeImpl>(a, static_cast<void *>(&maxTotalSize));
+
+    size_t releasedSize = 0u;
+    while (allocationsToRelease != nullptr) {
+        auto next = allocationsToRelease->next;
+        allocationsToRelease->next = nullptr;
+        allocationsToRelease->prev = nullptr;
+        releasedSize += allocationsToRelease->getUnderlyingBufferSize();
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocationsToRelease);
+        allocationsToRelease = next;
+    }
+    return releasedSize;
+}
+
+GraphicsAllocation *AllocationsList::detachAllocationsAboveSizeImpl(GraphicsAllocation *, void *data) {
+    const size_t maxTotalSize = *static_cast<size_t *>(data);
+    size_t totalSize = 0u;
+    auto *curr = head;
+    while (curr != nullptr) {
+        totalSize += curr->getUnderlyingBufferSize();
+        if (totalSize > maxTotalSize) {
+            // most recently stored allocations are kept at the front, release the least recently used ones
+            return detachSequenceImpl(curr, tail);
+        }
+        curr = curr->next;
+    }
+    return nullptr;
+}
+
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
     auto *curr = head;
     while (curr != nullptr) {
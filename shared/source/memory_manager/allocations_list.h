@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,11 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, bool forceSystemMemoryFlag, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
+    size_t trimToSize(size_t maxTotalSize, MemoryManager *memoryManager);
 
   private:
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachAllocationsAboveSizeImpl(GraphicsAllocation *, void *);
 
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
 };
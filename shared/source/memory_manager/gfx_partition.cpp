@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -14,6 +15,9 @@
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
+#include <cstdio>
+
 namespace NEO {
 
 const std::array<HeapIndex, 4> GfxPartition::heap32Names{{HeapIndex::heapInternalDeviceMemory,
@@ -97,6 +101,9 @@ static void reserve57BitRangeWithMemoryMapsParse(OSMemory *osMemory, OSMemory::R
 GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForHeapSvm) : reservedCpuAddressRangeForHeapSvm(reservedCpuAddressRangeForHeapSvm), osMemory(OSMemory::create()) {}
 
 GfxPartition::~GfxPartition() {
+    if (debugManager.flags.PrintGfxPartitionHeapStatistics.get()) {
+        printHeapStatistics();
+    }
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapSvm);
     reservedCpuAddressRangeForHeapSvm = {};
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapExtended);
@@ -158,6 +165,56 @@ void GfxPartition::Heap::free(uint64_t ptr, size_t size) {
     alloc->free(ptr, size);
 }
 
+HeapStatistics GfxPartition::Heap::getStatistics() const {
+    if (!alloc) {
+        return {};
+    }
+    return alloc->getStatistics();
+}
+
+HeapStatistics GfxPartition::getHeapStatistics(HeapIndex heapIndex) {
+    return getHeap(heapIndex).getStatistics();
+}
+
+uint64_t GfxPartition::borrowFromStandardHeap(HeapIndex heapIndex, size_t &size, size_t alignment) {
+    if (debugManager.flags.BorrowStandardHeapVa.get() != 1) {
+        return 0u;
+    }
+    if (heapIndex != HeapIndex::heapStandard64KB && heapIndex != HeapIndex::heapStandard2MB) {
+        return 0u;
+    }
+    auto &standardHeap = getHeap(HeapIndex::heapStandard);
+    if (standardHeap.getSize() == 0u) {
+        return 0u;
+    }
+
+    // Borrowed range keeps granularity of the exhausted heap and is released by address to HEAP_STANDARD
+    const size_t granularity = static_cast<size_t>(heapIndex == HeapIndex::heapStandard2MB ? GfxPartition::heapGranularity2MB : GfxPartition::heapGranularity);
+    alignment = std::max(alignment, granularity);
+    size = alignUp(size, granularity);
+    auto gpuVa = standardHeap.allocateWithCustomAlignment(size, alignment);
+    if (gpuVa != 0u) {
+        totalBorrowedVaSize += size;
+    }
+    return gpuVa;
+}
+
+void GfxPartition::printHeapStatistics() {
+    for (uint32_t heapIndex = 0u; heapIndex < static_cast<uint32_t>(HeapIndex::totalHeaps); heapIndex++) {
+        auto &heap = getHeap(static_cast<HeapIndex>(heapIndex));
+        if (heap.getSize() == 0u) {
+            continue;
+        }
+        auto statistics = heap.getStatistics();
+        PRINT_DEBUG_STRING(debugManager.flags.PrintGfxPartitionHeapStatistics.get(), stdout,
+                           "GfxPartition heap %u: free size: %llu, largest free chunk: %llu, free chunks: %u, free chunks histogram <64KB: %u, <2MB: %u, <64MB: %u, <1GB: %u, >=1GB: %u\n",
+                           heapIndex, static_cast<unsigned long long>(statistics.freeSize), static_cast<unsigned long long>(statistics.largestFreeChunk), statistics.freeChunksCount,
+                           statistics.freeChunksHistogram[0], statistics.freeChunksHistogram[1], statistics.freeChunksHistogram[2], statistics.freeChunksHistogram[3], statistics.freeChunksHistogram[4]);
+    }
+    PRINT_DEBUG_STRING(debugManager.flags.PrintGfxPartitionHeapStatistics.get(), stdout,
+                       "GfxPartition total VA borrowed from standard heap: %llu\n", static_cast<unsigned long long>(totalBorrowedVaSize.load()));
+}
+
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
     for (auto heapName : GfxPartition::heapNonSvmNames) {
         auto &heap = getHeap(heapName);
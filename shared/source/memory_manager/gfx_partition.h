@@ -10,9 +10,11 @@
 #include "shared/source/os_interface/os_memory.h"
 
 #include <array>
+#include <atomic>
 
 namespace NEO {
 class HeapAllocator;
+struct HeapStatistics;
 
 enum class HeapIndex : uint32_t {
     heapInternalDeviceMemory = 0u,
@@ -62,11 +64,19 @@ class GfxPartition {
     }
 
     MOCKABLE_VIRTUAL uint64_t heapAllocate(HeapIndex heapIndex, size_t &size) {
-        return getHeap(heapIndex).allocate(size);
+        auto gpuVa = getHeap(heapIndex).allocate(size);
+        if (gpuVa == 0u) {
+            gpuVa = borrowFromStandardHeap(heapIndex, size, 0u);
+        }
+        return gpuVa;
     }
 
     MOCKABLE_VIRTUAL uint64_t heapAllocateWithCustomAlignment(HeapIndex heapIndex, size_t &size, size_t alignment) {
-        return getHeap(heapIndex).allocateWithCustomAlignment(size, alignment);
+        auto gpuVa = getHeap(heapIndex).allocateWithCustomAlignment(size, alignment);
+        if (gpuVa == 0u) {
+            gpuVa = borrowFromStandardHeap(heapIndex, size, alignment);
+        }
+        return gpuVa;
     }
 
     MOCKABLE_VIRTUAL void heapFree(HeapIndex heapIndex, uint64_t ptr, size_t size) {
@@ -85,6 +95,10 @@ class GfxPartition {
 
     uint64_t getHeapMinimalAddress(HeapIndex heapIndex);
 
+    HeapStatistics getHeapStatistics(HeapIndex heapIndex);
+
+    uint64_t getTotalBorrowedVaSize() const { return totalBorrowedVaSize; }
+
     bool isLimitedRange() { return getHeap(HeapIndex::heapSvm).getSize() == 0ull; }
 
     static bool isAnyHeap32(HeapIndex heapIndex) {
@@ -105,6 +119,8 @@ class GfxPartition {
 
   protected:
     bool initAdditionalRange(uint32_t cpuAddressWidth, uint64_t gpuAddressSpace, uint64_t &gfxBase, uint64_t &gfxTop, uint32_t rootDeviceIndex, size_t numRootDevices, uint64_t systemMemorySize);
+    uint64_t borrowFromStandardHeap(HeapIndex heapIndex, size_t &size, size_t alignment);
+    void printHeapStatistics();
 
     class Heap {
       public:
@@ -119,6 +135,7 @@ class GfxPartition {
         uint64_t allocate(size_t &size);
         uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
         void free(uint64_t ptr, size_t size);
+        HeapStatistics getStatistics() const;
 
       protected:
         uint64_t base = 0, size = 0;
@@ -134,5 +151,6 @@ class GfxPartition {
     OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForHeapSvm;
     OSMemory::ReservedCpuAddressRange reservedCpuAddressRangeForHeapExtended{};
     std::unique_ptr<OSMemory> osMemory;
+    std::atomic<uint64_t> totalBorrowedVaSize{0u}; // cumulative, not decreased when borrowed ranges are freed
 };
 } // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -46,13 +47,23 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     auto memoryManager = commandStreamReceiver.getMemoryManager();
     auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
+    auto hostPtrCacheSize = (&allocationsList == &allocationLists[TEMPORARY_ALLOCATION]) ? getHostPtrAllocationCacheSize() : 0u;
+    bool hostPtrCacheUpdated = false;
+
     GraphicsAllocation *curr = allocationsList.detachNodes();
 
     IDList<GraphicsAllocation, false, true> allocationsLeft;
     while (curr != nullptr) {
         auto *next = curr->next;
         if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
-            memoryManager->freeGraphicsMemory(curr);
+            if (hostPtrCacheSize > 0 && curr->getAllocationType() == AllocationType::externalHostPtr) {
+                curr->next = nullptr;
+                curr->prev = nullptr;
+                hostPtrAllocationCache.pushFrontOne(*curr);
+                hostPtrCacheUpdated = true;
+            } else {
+                memoryManager->freeGraphicsMemory(curr);
+            }
         } else {
             allocationsLeft.pushTailOne(*curr);
         }
@@ -62,6 +73,23 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     if (allocationsLeft.peekIsEmpty() == false) {
         allocationsList.splice(*allocationsLeft.detachNodes());
     }
+
+    if (hostPtrCacheUpdated) {
+        hostPtrAllocationCache.trimToSize(hostPtrCacheSize, memoryManager);
+    }
+}
+
+size_t InternalAllocationStorage::getHostPtrAllocationCacheSize() const {
+    if (debugManager.flags.HostPtrAllocationCacheSize.get() > 0 && commandStreamReceiver.getMemoryManager()->isHostPtrAllocationCacheSupported()) {
+        return static_cast<size_t>(debugManager.flags.HostPtrAllocationCacheSize.get()) * MemoryConstants::kiloByte;
+    }
+    return 0u;
+}
+
+void InternalAllocationStorage::releaseHostPtrAllocationCache() {
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+    hostPtrAllocationCache.trimToSize(0u, memoryManager);
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, AllocationType allocationType) {
@@ -71,6 +99,10 @@ std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAll
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainTemporaryAllocationWithPtr(size_t requiredSize, const void *requiredPtr, AllocationType allocationType) {
     auto allocation = allocationLists[TEMPORARY_ALLOCATION].detachAllocation(requiredSize, requiredPtr, &commandStreamReceiver, allocationType);
+    if (!allocation && !hostPtrAllocationCache.peekIsEmpty()) {
+        allocation = hostPtrAllocationCache.detachAllocation(requiredSize, requiredPtr, &commandStreamReceiver, allocationType);
+        allocation ? hostPtrAllocationCacheHits++ : hostPtrAllocationCacheMisses++;
+    }
     return allocation;
 }
 
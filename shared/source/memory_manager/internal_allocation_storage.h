@@ -24,12 +24,22 @@ class InternalAllocationStorage {
     AllocationsList &getTemporaryAllocations() { return allocationLists[TEMPORARY_ALLOCATION]; }
     AllocationsList &getAllocationsForReuse() { return allocationLists[REUSABLE_ALLOCATION]; }
     AllocationsList &getDeferredAllocations() { return allocationLists[DEFERRED_DEALLOCATION]; }
+    AllocationsList &getHostPtrAllocationCache() { return hostPtrAllocationCache; }
+    void releaseHostPtrAllocationCache();
     DeviceBitfield getDeviceBitfield() const;
 
+    uint64_t hostPtrAllocationCacheHits = 0;
+    uint64_t hostPtrAllocationCacheMisses = 0;
+
   protected:
     void freeAllocationsList(TaskCountType waitTaskCount, AllocationsList &allocationsList);
+    size_t getHostPtrAllocationCacheSize() const;
     CommandStreamReceiver &commandStreamReceiver;
 
     std::array<AllocationsList, 3> allocationLists = {AllocationsList(TEMPORARY_ALLOCATION), AllocationsList(REUSABLE_ALLOCATION), AllocationsList(DEFERRED_DEALLOCATION)};
+
+    // Completed external host pointer allocations, most recently used first; reusing them
+    // avoids recreating OS handles (e.g. userptr buffer objects) for repeated transfers from the same host memory
+    AllocationsList hostPtrAllocationCache{TEMPORARY_ALLOCATION};
 };
 } // namespace NEO
@@ -923,6 +923,8 @@ void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForComplet
                 csr->waitForCompletionWithTimeout(WaitParams{false, false, 0}, csr->peekLatestSentTaskCount());
             }
             csr->getInternalAllocationStorage()->cleanAllocationList(*csr->getTagAddress(), AllocationUsage::TEMPORARY_ALLOCATION);
+            // cached host pointer allocations keep their fragments referenced, drop them so overlapping ranges can be resolved
+            csr->getInternalAllocationStorage()->releaseHostPtrAllocationCache();
         }
     }
 }
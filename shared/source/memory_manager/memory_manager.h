@@ -281,6 +281,10 @@ class MemoryManager {
         return true;
     }
 
+    virtual bool isHostPtrAllocationCacheSupported() const {
+        return false;
+    }
+
     bool isKernelBinaryReuseEnabled();
 
     struct KernelAllocationInfo {
@@ -18,7 +18,7 @@ std::unique_ptr<PrefetchManager> PrefetchManager::create() {
 
 void PrefetchManager::insertAllocation(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData) {
     std::unique_lock<SpinLock> lock{context.lock};
-    if (allocData.memoryType == InternalMemoryType::sharedUnifiedMemory) {
+    if (allocData.memoryType == InternalMemoryType::sharedUnifiedMemory && context.allocationsSet.insert(usmPtr).second) {
         context.allocations.push_back(usmPtr);
     }
 }
@@ -29,6 +29,8 @@ void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAlloc
         auto allocData = unifiedMemoryManager.getSVMAlloc(ptr);
         if (allocData) {
             unifiedMemoryManager.prefetchMemory(device, csr, *allocData);
+            prefetchedBytes += allocData->size;
+            prefetchedAllocationsCount++;
         }
     }
 }
@@ -36,6 +38,7 @@ void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAlloc
 void PrefetchManager::removeAllocations(PrefetchContext &context) {
     std::unique_lock<SpinLock> lock{context.lock};
     context.allocations.clear();
+    context.allocationsSet.clear();
 }
 
 } // namespace NEO
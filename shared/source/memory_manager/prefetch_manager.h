@@ -10,7 +10,10 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -22,6 +25,7 @@ class SVMAllocsManager;
 
 struct PrefetchContext {
     std::vector<const void *> allocations;
+    std::unordered_set<const void *> allocationsSet;
     SpinLock lock;
 };
 
@@ -36,6 +40,13 @@ class PrefetchManager : public NonCopyableOrMovableClass {
     MOCKABLE_VIRTUAL void migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr);
 
     MOCKABLE_VIRTUAL void removeAllocations(PrefetchContext &context);
+
+    uint64_t getPrefetchedBytes() const { return prefetchedBytes; }
+    uint64_t getPrefetchedAllocationsCount() const { return prefetchedAllocationsCount; }
+
+  protected:
+    std::atomic<uint64_t> prefetchedBytes{0u};
+    std::atomic<uint64_t> prefetchedAllocationsCount{0u};
 };
 
 } // namespace NEO
@@ -233,6 +233,7 @@ class BufferObject {
     uint32_t getOsContextId(OsContext *osContext);
 
     const auto &getBindInfo() const { return bindInfo; }
+    void clearBindInfo(OsContext *osContext, uint32_t vmHandleId) { bindInfo[getOsContextId(osContext)][vmHandleId] = false; }
 
     void setChunked(bool chunked) { this->chunked = chunked; }
     bool isChunked() const { return this->chunked; }
@@ -74,8 +74,22 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     MOCKABLE_VIRTUAL void readBackAllocation(void *source);
     bool isUserFenceWaitActive();
 
+    bool reuseResidencyWorkingSet(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId);
+    void storeResidencyWorkingSet(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId);
+
+    // Buffer objects made resident for the last submission on a given vm handle
+    struct ResidencyWorkingSet {
+        ResidencyContainer allocations;
+        std::vector<BufferObject *> bufferObjects;
+        uint64_t generation = 0;
+        bool valid = false;
+    };
+
     std::vector<BufferObject *> residency;
     std::vector<ExecObject> execObjectsStorage;
+    std::vector<ResidencyWorkingSet> residencyWorkingSets;
+    uint64_t residencyWorkingSetHits = 0;
+    uint64_t residencyWorkingSetMisses = 0;
     Drm *drm;
     GemCloseWorkerMode gemCloseWorkerOperationMode;
 
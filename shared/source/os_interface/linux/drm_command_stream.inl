@@ -259,6 +259,10 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::processResidency(const Res
     if (drm->isVmBindAvailable()) {
         return SubmissionStatus::success;
     }
+    bool residencyEmpty = this->residency.empty();
+    if (residencyEmpty && reuseResidencyWorkingSet(inputAllocationsForResidency, handleId)) {
+        return SubmissionStatus::success;
+    }
     int ret = 0;
     for (auto &alloc : inputAllocationsForResidency) {
         auto drmAlloc = static_cast<DrmAllocation *>(alloc);
@@ -267,10 +271,52 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::processResidency(const Res
             break;
         }
     }
+    if (ret == 0 && residencyEmpty) {
+        storeResidencyWorkingSet(inputAllocationsForResidency, handleId);
+    }
 
     return Drm::getSubmissionStatusFromReturnCode(ret);
 }
 
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::reuseResidencyWorkingSet(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    if (debugManager.flags.EnableResidencyWorkingSetReuse.get() != 1) {
+        return false;
+    }
+    if (handleId >= residencyWorkingSets.size()) {
+        residencyWorkingSetMisses++;
+        return false;
+    }
+
+    auto &workingSet = residencyWorkingSets[handleId];
+    if (!workingSet.valid ||
+        workingSet.generation != getMemoryManager()->peekResidencyGeneration() ||
+        workingSet.allocations != inputAllocationsForResidency) {
+        residencyWorkingSetMisses++;
+        return false;
+    }
+
+    this->residency = workingSet.bufferObjects;
+    residencyWorkingSetHits++;
+    return true;
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::storeResidencyWorkingSet(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    if (debugManager.flags.EnableResidencyWorkingSetReuse.get() != 1) {
+        return;
+    }
+    if (handleId >= residencyWorkingSets.size()) {
+        residencyWorkingSets.resize(handleId + 1);
+    }
+
+    auto &workingSet = residencyWorkingSets[handleId];
+    workingSet.allocations = inputAllocationsForResidency;
+    workingSet.bufferObjects = this->residency;
+    workingSet.generation = getMemoryManager()->peekResidencyGeneration();
+    workingSet.valid = true;
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gfxAllocation) {
     // Vector is moved to command buffer inside flush.
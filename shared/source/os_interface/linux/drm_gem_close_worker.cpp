@@ -13,9 +13,9 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
-#include <queue>
 
 namespace NEO {
 
@@ -42,7 +42,8 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
+    queue.push_back(bo);
+    statistics.maxPendingBufferObjects = std::max(statistics.maxPendingBufferObjects, static_cast<uint32_t>(queue.size()));
     lock.unlock();
     condition.notify_one();
 }
@@ -59,24 +60,35 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+DrmGemCloseWorker::Statistics DrmGemCloseWorker::getStatistics() {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    return statistics;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
     workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
+inline void DrmGemCloseWorker::processQueue(std::vector<BufferObject *> &inputQueue) {
+    if (inputQueue.empty()) {
+        return;
+    }
+    auto batchSize = inputQueue.size();
+    for (auto workItem : inputQueue) {
         close(workItem);
     }
+    inputQueue.clear();
+
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    statistics.closedBufferObjects += batchSize;
+    statistics.closedBatches++;
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
+    std::vector<BufferObject *> localQueue;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
@@ -96,9 +108,10 @@ void *DrmGemCloseWorker::worker(void *arg) {
     }
 
     lock.lock();
-    self->processQueue(self->queue);
-
+    localQueue.swap(self->queue);
     lock.unlock();
+    self->processQueue(localQueue);
+
     self->workerDone.store(true);
     return nullptr;
 }
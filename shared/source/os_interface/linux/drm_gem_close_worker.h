@@ -11,8 +11,8 @@
 #include <cstdint>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -26,6 +26,12 @@ enum class GemCloseWorkerMode {
 
 class DrmGemCloseWorker {
   public:
+    struct Statistics {
+        uint64_t closedBufferObjects = 0;
+        uint64_t closedBatches = 0;
+        uint32_t maxPendingBufferObjects = 0;
+    };
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
@@ -36,18 +42,20 @@ class DrmGemCloseWorker {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    Statistics getStatistics();
 
   protected:
     void close(BufferObject *workItem);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void processQueue(std::vector<BufferObject *> &inputQueue);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    std::vector<BufferObject *> queue;
     std::atomic<uint32_t> workCount{0};
+    Statistics statistics;
 
     DrmMemoryManager &memoryManager;
 
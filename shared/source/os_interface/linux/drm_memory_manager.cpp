@@ -45,6 +45,7 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <memory>
@@ -209,15 +210,18 @@ void DrmMemoryManager::commonCleanup() {
 }
 
 void DrmMemoryManager::eraseSharedBufferObject(NEO::BufferObject *bo) {
-    auto it = std::find(sharingBufferObjects.begin(), sharingBufferObjects.end(), bo);
-    DEBUG_BREAK_IF(it == sharingBufferObjects.end());
-    releaseGpuRange(reinterpret_cast<void *>((*it)->peekAddress()), (*it)->peekUnmapSize(), this->getRootDeviceIndex(bo->peekDrm()));
-    sharingBufferObjects.erase(it);
+    auto range = sharingBufferObjects.equal_range(getSharedBufferObjectKey(bo->getHandle(), bo->getRootDeviceIndex()));
+    auto it = std::find_if(range.first, range.second, [bo](const auto &entry) { return entry.second == bo; });
+    DEBUG_BREAK_IF(it == range.second);
+    releaseGpuRange(reinterpret_cast<void *>(bo->peekAddress()), bo->peekUnmapSize(), this->getRootDeviceIndex(bo->peekDrm()));
+    if (it != range.second) {
+        sharingBufferObjects.erase(it);
+    }
 }
 
 void DrmMemoryManager::pushSharedBufferObject(NEO::BufferObject *bo) {
     bo->markAsReusableAllocation();
-    sharingBufferObjects.push_back(bo);
+    sharingBufferObjects.emplace(getSharedBufferObjectKey(bo->getHandle(), bo->getRootDeviceIndex()), bo);
 }
 
 uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDestroy) {
@@ -253,6 +257,7 @@ uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDe
             lock.unlock();
         }
 
+        residencyGeneration++;
         delete bo;
     }
     return r;
@@ -427,6 +432,11 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
         return nullptr;
     }
 
+    if (debugManager.flags.EnableHostAllocationHugePageAdvise.get() == 1 && alignment >= MemoryConstants::pageSize2M) {
+        // must happen before pages are populated by userptr pinning
+        SysCalls::madvise(res, size, MADV_HUGEPAGE);
+    }
+
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, allocationData.rootDeviceIndex));
     if (!bo) {
         alignedFreeWrapper(res);
@@ -838,15 +848,13 @@ GraphicsAllocation *DrmMemoryManager::allocate32BitGraphicsMemoryImpl(const Allo
 }
 
 BufferObject *DrmMemoryManager::findAndReferenceSharedBufferObject(int boHandle, uint32_t rootDeviceIndex) {
-    BufferObject *bo = nullptr;
-    for (const auto &i : sharingBufferObjects) {
-        if (i->getHandle() == boHandle && i->getRootDeviceIndex() == rootDeviceIndex) {
-            bo = i;
-            bo->reference();
-            break;
-        }
+    auto it = sharingBufferObjects.find(getSharedBufferObjectKey(boHandle, rootDeviceIndex));
+    if (it == sharingBufferObjects.end()) {
+        return nullptr;
     }
 
+    auto bo = it->second;
+    bo->reference();
     return bo;
 }
 
@@ -1202,6 +1210,7 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
         return;
     }
     DrmAllocation *drmAlloc = static_cast<DrmAllocation *>(gfxAllocation);
+    residencyGeneration++;
     this->unregisterAllocation(gfxAllocation);
     auto rootDeviceIndex = gfxAllocation->getRootDeviceIndex();
     for (auto &engine : getRegisteredEngines(rootDeviceIndex)) {
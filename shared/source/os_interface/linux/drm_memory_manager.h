@@ -9,10 +9,12 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <unordered_map>
 
 namespace NEO {
 class BufferObject;
@@ -92,12 +94,18 @@ class DrmMemoryManager : public MemoryManager {
     void releaseDeviceSpecificMemResources(uint32_t rootDeviceIndex) override;
     void createDeviceSpecificMemResources(uint32_t rootDeviceIndex) override;
     bool allowIndirectAllocationsAsPack(uint32_t rootDeviceIndex) override;
+    // userptr MMU notifier invalidates cached host ptr allocations of unmapped ranges
+    bool isHostPtrAllocationCacheSupported() const override { return true; }
     Drm &getDrm(uint32_t rootDeviceIndex) const;
     size_t getSizeOfChunk(size_t allocSize);
     bool checkAllocationForChunking(size_t allocSize, size_t minSize, bool subDeviceEnabled, bool debugDisabled, bool modeEnabled, bool bufferEnabled);
 
     MOCKABLE_VIRTUAL void checkUnexpectedGpuPageFault();
 
+    // Changes whenever an allocation or a buffer object is released, so that residency lists
+    // built from allocation and buffer object pointers can be validated before reuse
+    uint64_t peekResidencyGeneration() const { return residencyGeneration.load(); }
+
     bool allocateInterrupt(uint32_t &outHandle, uint32_t rootDeviceIndex) override;
     bool releaseInterrupt(uint32_t outHandle, uint32_t rootDeviceIndex) override;
 
@@ -172,7 +180,11 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
     decltype(&close) closeFunction = close;
-    std::vector<BufferObject *> sharingBufferObjects;
+    static uint64_t getSharedBufferObjectKey(int boHandle, uint32_t rootDeviceIndex) {
+        return (static_cast<uint64_t>(rootDeviceIndex) << 32) | static_cast<uint32_t>(boHandle);
+    }
+
+    std::unordered_multimap<uint64_t, BufferObject *> sharingBufferObjects;
     std::mutex mtx;
 
     std::map<int, BufferObjectHandleWrapper> sharedBoHandles;
@@ -180,5 +192,6 @@ class DrmMemoryManager : public MemoryManager {
     std::vector<size_t> localMemBanksCount;
     std::vector<GraphicsAllocation *> sysMemAllocs;
     std::mutex allocMutex;
+    std::atomic<uint64_t> residencyGeneration{0};
 };
 } // namespace NEO
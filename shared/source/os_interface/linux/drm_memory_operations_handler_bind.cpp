@@ -17,7 +17,10 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_interface.h"
 
 namespace NEO {
 
@@ -47,9 +50,26 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::lock(Device *device, Arra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto ioctlHelper = rootDeviceEnvironment.osInterface->getDriverModel()->as<Drm>()->getIoctlHelper();
+    bool bindBatchStarted = ioctlHelper->beginVmBindBatch();
+
+    std::vector<std::pair<BufferObject *, uint32_t>> batchedBindings;
+    auto result = makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable, bindBatchStarted ? &batchedBindings : nullptr);
+
+    if (bindBatchStarted && ioctlHelper->flushVmBindBatch() != 0) {
+        for (auto &[bo, vmHandleId] : batchedBindings) {
+            bo->clearBindInfo(osContext, vmHandleId);
+        }
+        result = MemoryOperationsStatus::outOfMemory;
+    }
+    return result;
+}
+
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, std::vector<std::pair<BufferObject *, uint32_t>> *batchedBindings) {
     auto deviceBitfield = osContext->getDeviceBitfield();
 
-    std::lock_guard<std::mutex> lock(mutex);
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -67,6 +87,18 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
 
             if (!bo->getBindInfo()[bo->getOsContextId(osContext)][drmIterator]) {
                 bo->requireExplicitLockedMemory(drmAllocation->isLockedMemory());
+                if (batchedBindings) {
+                    // bind state is set before batched binds are submitted, remember it to roll back on failed flush
+                    if (drmAllocation->storageInfo.getNumBanks() > 1 && !drmAllocation->storageInfo.tileInstanced) {
+                        for (auto bankBo : drmAllocation->getBOs()) {
+                            if (bankBo && !bankBo->getBindInfo()[bankBo->getOsContextId(osContext)][drmIterator]) {
+                                batchedBindings->emplace_back(bankBo, drmIterator);
+                            }
+                        }
+                    } else {
+                        batchedBindings->emplace_back(bo, drmIterator);
+                    }
+                }
                 int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
                 if (result) {
                     return MemoryOperationsStatus::outOfMemory;
@@ -9,7 +9,11 @@
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <utility>
+#include <vector>
+
 namespace NEO {
+class BufferObject;
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
@@ -29,6 +33,7 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
     MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
 
   protected:
+    MemoryOperationsStatus makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, std::vector<std::pair<BufferObject *, uint32_t>> *batchedBindings);
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
     MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
     const RootDeviceEnvironment &rootDeviceEnvironment;
@@ -986,6 +986,16 @@ std::vector<uint64_t> Drm::getMemoryRegions() {
 
 bool Drm::queryMemoryInfo() {
     this->memoryInfo = ioctlHelper->createMemoryInfo();
+    if (this->memoryInfo && debugManager.flags.HostAllocationNumaNodeSelection.get() == 2) {
+        std::string numaNode(64, '\0');
+        if (readSysFsAsString("/device/numa_node", numaNode)) {
+            char *endPtr = nullptr;
+            auto node = static_cast<int>(std::strtol(numaNode.data(), &endPtr, 10));
+            if (endPtr != numaNode.data()) {
+                this->memoryInfo->setDeviceNumaNode(node);
+            }
+        }
+    }
     return this->memoryInfo != nullptr;
 }
 
@@ -17,6 +17,7 @@
 #include "shared/source/os_interface/linux/numa_library.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace NEO {
@@ -74,6 +75,13 @@ int MemoryInfo::createGemExt(const MemRegionsVec &memClassInstances, size_t allo
     if (memPolicySupported &&
         isUSMHostAllocation &&
         Linux::NumaLibrary::getMemPolicy(&mode, memPolicyNodeMask)) {
+        auto numaNode = getHostAllocationNumaNode();
+        if (numaNode >= 0 && numaNode <= Linux::NumaLibrary::getMaxNode()) {
+            constexpr auto bitsPerMaskEntry = sizeof(unsigned long) * 8;
+            std::fill(memPolicyNodeMask.begin(), memPolicyNodeMask.end(), 0ul);
+            memPolicyNodeMask[numaNode / bitsPerMaskEntry] |= 1ul << (numaNode % bitsPerMaskEntry);
+            mode = memPolicyModePreferred;
+        }
         if (memPolicyMode != -1) {
             mode = memPolicyMode;
         }
@@ -83,6 +91,17 @@ int MemoryInfo::createGemExt(const MemRegionsVec &memClassInstances, size_t allo
     }
 }
 
+int MemoryInfo::getHostAllocationNumaNode() const {
+    switch (debugManager.flags.HostAllocationNumaNodeSelection.get()) {
+    case 1:
+        return Linux::NumaLibrary::getNodeOfCurrentCpu();
+    case 2:
+        return deviceNumaNode;
+    default:
+        return -1;
+    }
+}
+
 uint32_t MemoryInfo::getLocalMemoryRegionIndex(DeviceBitfield deviceBitfield) const {
     UNRECOVERABLE_IF(deviceBitfield.count() != 1u);
     auto &hwInfo = *this->drm.getRootDeviceEnvironment().getHardwareInfo();
@@ -46,6 +46,10 @@ class MemoryInfo {
     const RegionContainer &getLocalMemoryRegions() const { return localMemoryRegions; }
     const RegionContainer &getDrmRegionInfos() const { return drmQueryRegions; }
     bool isMemPolicySupported() const { return memPolicySupported; }
+    void setDeviceNumaNode(int numaNode) { deviceNumaNode = numaNode; }
+    int getHostAllocationNumaNode() const;
+
+    static constexpr int memPolicyModePreferred = 1;
 
   protected:
     const Drm &drm;
@@ -54,6 +58,7 @@ class MemoryInfo {
     const MemoryRegion &systemMemoryRegion;
     bool memPolicySupported;
     int memPolicyMode;
+    int deviceNumaNode = -1;
     RegionContainer localMemoryRegions;
     std::array<uint32_t, 4> tileToLocalMemoryRegionIndexMap{};
 };
@@ -11,6 +11,7 @@
 
 #include <cerrno>
 #include <iostream>
+#include <sched.h>
 
 namespace NEO {
 namespace Linux {
@@ -20,6 +21,8 @@ NumaLibrary::OsLibraryLoadPtr NumaLibrary::osLibraryLoadFunction(NEO::OsLibrary:
 NumaLibrary::GetMemPolicyPtr NumaLibrary::getMemPolicyFunction(nullptr);
 NumaLibrary::NumaAvailablePtr NumaLibrary::numaAvailableFunction(nullptr);
 NumaLibrary::NumaMaxNodePtr NumaLibrary::numaMaxNodeFunction(nullptr);
+NumaLibrary::NumaNodeOfCpuPtr NumaLibrary::numaNodeOfCpuFunction(nullptr);
+NumaLibrary::GetCpuPtr NumaLibrary::getCpuFunction(sched_getcpu);
 int NumaLibrary::maxNode(-1);
 bool NumaLibrary::numaLoaded(false);
 
@@ -29,11 +32,14 @@ bool NumaLibrary::init() {
     numaAvailableFunction = nullptr;
     numaMaxNodeFunction = nullptr;
     getMemPolicyFunction = nullptr;
+    numaNodeOfCpuFunction = nullptr;
     if (osLibrary) {
         DEBUG_BREAK_IF(!osLibrary->isLoaded());
         numaAvailableFunction = reinterpret_cast<NumaAvailablePtr>(osLibrary->getProcAddress(std::string(procNumaAvailableStr)));
         numaMaxNodeFunction = reinterpret_cast<NumaMaxNodePtr>(osLibrary->getProcAddress(std::string(procNumaMaxNodeStr)));
         getMemPolicyFunction = reinterpret_cast<GetMemPolicyPtr>(osLibrary->getProcAddress(std::string(procGetMemPolicyStr)));
+        // optional, only needed to select node of the calling thread
+        numaNodeOfCpuFunction = reinterpret_cast<NumaNodeOfCpuPtr>(osLibrary->getProcAddress(std::string(procNumaNodeOfCpuStr)));
         if (numaAvailableFunction && numaMaxNodeFunction && getMemPolicyFunction) {
             if ((*numaAvailableFunction)() == 0) {
                 maxNode = (*numaMaxNodeFunction)();
@@ -53,5 +59,16 @@ bool NumaLibrary::getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask)
     return false;
 }
 
+int NumaLibrary::getNodeOfCurrentCpu() {
+    if (!numaLoaded || numaNodeOfCpuFunction == nullptr) {
+        return -1;
+    }
+    auto cpu = (*getCpuFunction)();
+    if (cpu < 0) {
+        return -1;
+    }
+    return (*numaNodeOfCpuFunction)(cpu);
+}
+
 } // namespace Linux
 } // namespace NEO
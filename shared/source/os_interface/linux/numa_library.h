@@ -21,23 +21,30 @@ class NumaLibrary {
     static bool init();
     static bool isLoaded() { return numaLoaded; }
     static bool getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask);
+    static int getNodeOfCurrentCpu();
+    static int getMaxNode() { return maxNode; }
 
   protected:
     static constexpr const char *numaLibNameStr = "libnuma.so.1";
     static constexpr const char *procGetMemPolicyStr = "get_mempolicy";
     static constexpr const char *procNumaAvailableStr = "numa_available";
     static constexpr const char *procNumaMaxNodeStr = "numa_max_node";
+    static constexpr const char *procNumaNodeOfCpuStr = "numa_node_of_cpu";
 
     using OsLibraryLoadPtr = std::add_pointer<NEO::OsLibrary *(const std::string &)>::type;
     using GetMemPolicyPtr = std::add_pointer<long(int *, unsigned long[], unsigned long, void *, unsigned long)>::type;
     using NumaAvailablePtr = std::add_pointer<int(void)>::type;
     using NumaMaxNodePtr = std::add_pointer<int(void)>::type;
+    using NumaNodeOfCpuPtr = std::add_pointer<int(int)>::type;
+    using GetCpuPtr = std::add_pointer<int(void)>::type;
 
     static std::unique_ptr<NEO::OsLibrary> osLibrary;
     static OsLibraryLoadPtr osLibraryLoadFunction;
     static GetMemPolicyPtr getMemPolicyFunction;
     static NumaAvailablePtr numaAvailableFunction;
     static NumaMaxNodePtr numaMaxNodeFunction;
+    static NumaNodeOfCpuPtr numaNodeOfCpuFunction;
+    static GetCpuPtr getCpuFunction;
     static int maxNode;
     static bool numaLoaded;
 };
@@ -127,6 +127,10 @@ int munmap(void *addr, size_t size) noexcept {
     return ::munmap(addr, size);
 }
 
+int madvise(void *addr, size_t size, int advice) noexcept {
+    return ::madvise(addr, size, advice);
+}
+
 ssize_t read(int fd, void *buf, size_t count) {
     return ::read(fd, buf, count);
 }
@@ -1280,6 +1280,16 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
 
         bindInfo[index].addr = bind.bind.addr;
 
+        if (isBind && bind.bind.extensions == 0u && isVmBindBatchOwner()) {
+            return deferVmBind(bind.vm_id, bind.bind, sync[0]);
+        }
+        // deferred binds got lower user fence values under bind fence lock, signal them before this one
+        ret = submitPendingVmBinds();
+        if (ret != 0) {
+            xeLog("error: %s\n", operation);
+            return ret;
+        }
+
         ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
 
         xeLog(" vm=%d obj=0x%x off=0x%llx range=0x%llx addr=0x%llx operation=%d(%s) flags=%d(%s) nsy=%d pat=%hu ret=%d\n",
@@ -1301,17 +1311,7 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
             return ret;
         }
 
-        constexpr auto oneSecTimeout = 1000000000ll;
-        constexpr auto infiniteTimeout = -1;
-        bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
-        uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
-        if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
-            timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
-        }
-        return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
-                               sync[0].addr,
-                               sync[0].timeline_value, timeout,
-                               false, NEO::InterruptId::notUsed, nullptr);
+        return xeWaitVmBindUserFence(bind.exec_queue_id, sync[0].addr, sync[0].timeline_value);
     }
 
     xeLog("error:  -> IoctlHelperXe::%s %s index=%d vmid=0x%x h=0x%x s=0x%llx o=0x%llx l=0x%llx f=0x%llx pat=%hu r=%d\n",
@@ -1322,6 +1322,117 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
     return ret;
 }
 
+int IoctlHelperXe::xeWaitVmBindUserFence(uint32_t execQueueId, uint64_t addr, uint64_t value) {
+    constexpr auto oneSecTimeout = 1000000000ll;
+    constexpr auto infiniteTimeout = -1;
+    bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
+    uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
+    if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
+        timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
+    }
+    return xeWaitUserFence(execQueueId, DRM_XE_UFENCE_WAIT_OP_EQ, addr, value, timeout,
+                           false, NEO::InterruptId::notUsed, nullptr);
+}
+
+bool IoctlHelperXe::beginVmBindBatch() {
+    if (debugManager.flags.EnableVmBindBatching.get() != 1) {
+        return false;
+    }
+    if (debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get() == 1) {
+        // waiting on paging fence after each bind requires the bind to be already submitted
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(xeLock);
+    if (pendingVmBinds.active) {
+        return false;
+    }
+    pendingVmBinds.active = true;
+    pendingVmBinds.owner = std::this_thread::get_id();
+    return true;
+}
+
+int IoctlHelperXe::flushVmBindBatch() {
+    if (!isVmBindBatchOwner()) {
+        return 0;
+    }
+    int ret = 0;
+    {
+        // binds of other threads write higher user fence values, keep them ordered after this batch
+        auto bindFenceLock = drm.lockBindFenceMutex();
+        ret = submitPendingVmBinds();
+    }
+
+    std::unique_lock<std::mutex> lock(xeLock);
+    pendingVmBinds.active = false;
+    pendingVmBinds.owner = std::thread::id();
+    return ret;
+}
+
+bool IoctlHelperXe::isVmBindBatchOwner() {
+    std::unique_lock<std::mutex> lock(xeLock);
+    return pendingVmBinds.active && pendingVmBinds.owner == std::this_thread::get_id();
+}
+
+int IoctlHelperXe::deferVmBind(uint32_t vmId, const drm_xe_vm_bind_op &bindOp, const drm_xe_sync &sync) {
+    std::unique_lock<std::mutex> lock(pendingVmBindsMutex);
+    if (!pendingVmBinds.ops.empty() && (pendingVmBinds.vmId != vmId || pendingVmBinds.fenceAddress != sync.addr)) {
+        auto ret = submitPendingVmBindsLocked();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    pendingVmBinds.ops.push_back(bindOp);
+    pendingVmBinds.vmId = vmId;
+    pendingVmBinds.fenceAddress = sync.addr;
+    pendingVmBinds.fenceValue = sync.timeline_value;
+
+    if (pendingVmBinds.ops.size() >= PendingVmBinds::maxBindsPerIoctl) {
+        return submitPendingVmBindsLocked();
+    }
+    return 0;
+}
+
+int IoctlHelperXe::submitPendingVmBinds() {
+    std::unique_lock<std::mutex> lock(pendingVmBindsMutex);
+    return submitPendingVmBindsLocked();
+}
+
+int IoctlHelperXe::submitPendingVmBindsLocked() {
+    if (pendingVmBinds.ops.empty()) {
+        return 0;
+    }
+
+    drm_xe_sync sync[1] = {};
+    sync[0].type = DRM_XE_SYNC_TYPE_USER_FENCE;
+    sync[0].flags = DRM_XE_SYNC_FLAG_SIGNAL;
+    sync[0].addr = pendingVmBinds.fenceAddress;
+    sync[0].timeline_value = pendingVmBinds.fenceValue;
+
+    drm_xe_vm_bind bind = {};
+    bind.vm_id = pendingVmBinds.vmId;
+    bind.num_binds = static_cast<uint32_t>(pendingVmBinds.ops.size());
+    bind.num_syncs = 1;
+    bind.syncs = reinterpret_cast<uintptr_t>(&sync);
+    if (bind.num_binds == 1) {
+        bind.bind = pendingVmBinds.ops[0];
+    } else {
+        bind.vector_of_binds = reinterpret_cast<uintptr_t>(pendingVmBinds.ops.data());
+    }
+
+    auto ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
+
+    xeLog(" vm=%d num_binds=%u fence=0x%llx value=0x%llx ret=%d\n",
+          bind.vm_id, bind.num_binds, sync[0].addr, sync[0].timeline_value, ret);
+
+    pendingVmBinds.ops.clear();
+    if (ret != 0) {
+        xeLog("error: batched bind\n");
+        return ret;
+    }
+    return xeWaitVmBindUserFence(bind.exec_queue_id, sync[0].addr, sync[0].timeline_value);
+}
+
 std::string IoctlHelperXe::getDrmParamString(DrmParam drmParam) const {
     switch (drmParam) {
     case DrmParam::contextCreateExtSetparam:
@@ -14,8 +14,11 @@
 #include <bitset>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 struct drm_xe_engine_class_instance;
+struct drm_xe_sync;
+struct drm_xe_vm_bind_op;
 struct drm_xe_query_gt_list;
 struct drm_xe_query_config;
 
@@ -79,6 +82,8 @@ class IoctlHelperXe : public IoctlHelper {
     uint32_t getVmAdviseAtomicAttribute() override;
     int vmBind(const VmBindParams &vmBindParams) override;
     int vmUnbind(const VmBindParams &vmBindParams) override;
+    bool beginVmBindBatch() override;
+    int flushVmBindBatch() override;
     int getResetStats(ResetStats &resetStats, uint32_t *status, ResetStatsFault *resetStatsFault) override;
     bool getEuStallProperties(std::array<uint64_t, 12u> &properties, uint64_t dssBufferSize, uint64_t samplingRate, uint64_t pollPeriod,
                               uint64_t engineInstance, uint64_t notifyNReports) override;
@@ -146,6 +151,11 @@ class IoctlHelperXe : public IoctlHelper {
     virtual int xeWaitUserFence(uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout, bool userInterrupt, uint32_t externalInterruptId, GraphicsAllocation *allocForInterruptWait);
     void setupXeWaitUserFenceStruct(void *arg, uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
+    int xeWaitVmBindUserFence(uint32_t execQueueId, uint64_t addr, uint64_t value);
+    bool isVmBindBatchOwner();
+    int deferVmBind(uint32_t vmId, const drm_xe_vm_bind_op &bindOp, const drm_xe_sync &sync);
+    int submitPendingVmBinds();
+    int submitPendingVmBindsLocked();
     void xeShowBindTable();
     void updateBindInfo(uint32_t handle, uint64_t userPtr, uint64_t size);
     void *allocateDebugMetadata();
@@ -178,6 +188,20 @@ class IoctlHelperXe : public IoctlHelper {
     int maxExecQueuePriority = 0;
     std::mutex xeLock;
     std::vector<BindInfo> bindInfo;
+
+    // Binds deferred between beginVmBindBatch and flushVmBindBatch, submitted as a single
+    // array bind signaling the user fence of the last deferred bind
+    struct PendingVmBinds {
+        static constexpr size_t maxBindsPerIoctl = 512u;
+
+        std::vector<drm_xe_vm_bind_op> ops;
+        std::thread::id owner;
+        uint64_t fenceAddress = 0u;
+        uint64_t fenceValue = 0u;
+        uint32_t vmId = 0u;
+        bool active = false;
+    } pendingVmBinds;
+    std::mutex pendingVmBindsMutex;
     std::vector<uint32_t> hwconfig;
     std::vector<drm_xe_engine_class_instance> contextParamEngine;
 
@@ -8,6 +8,8 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -20,8 +22,17 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::cpu : AllocationDomain::none;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    if (debugManager.flags.SharedAllocationMigrationChunkSize.get() > 0 && this->gpuDomainHandler == &PageFaultManager::transferAndUnprotectMemory) {
+        auto chunkSize = alignUp(static_cast<size_t>(debugManager.flags.SharedAllocationMigrationChunkSize.get()) * MemoryConstants::kiloByte, MemoryConstants::pageSize);
+        if (size > chunkSize && this->isRangeMigrationSupported()) {
+            pageFaultData.migrationChunkSize = chunkSize;
+            pageFaultData.cpuChunks.resize((size + chunkSize - 1) / chunkSize, domain == AllocationDomain::cpu);
+        }
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -36,6 +47,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (pageFaultData.migrationChunkSize != 0u) {
+                // chunks not touched by CPU are still protected
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -71,7 +86,9 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 }
 
 inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
-    if (pageFaultData.domain == AllocationDomain::cpu) {
+    if (pageFaultData.domain == AllocationDomain::cpu && pageFaultData.migrationChunkSize != 0u) {
+        this->migrateChunksToGpuDomain(ptr, pageFaultData);
+    } else if (pageFaultData.domain == AllocationDomain::cpu) {
         this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
 
         std::chrono::steady_clock::time_point start;
@@ -97,18 +114,95 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::gpu;
 }
 
+void PageFaultManager::migrateChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    this->setCpuAllocEvictable(false, allocPtr, pageFaultData.unifiedMemoryManager);
+
+    if (debugManager.flags.RegisterPageFaultHandlerOnMigration.get()) {
+        if (this->checkFaultHandlerFromPageFaultManager() == false) {
+            this->registerFaultHandler();
+        }
+    }
+
+    auto &cpuChunks = pageFaultData.cpuChunks;
+    for (size_t chunk = 0u; chunk < cpuChunks.size();) {
+        if (!cpuChunks[chunk]) {
+            chunk++;
+            continue;
+        }
+        auto firstChunk = chunk;
+        while (chunk < cpuChunks.size() && cpuChunks[chunk]) {
+            cpuChunks[chunk++] = false;
+        }
+
+        auto rangeOffset = firstChunk * pageFaultData.migrationChunkSize;
+        auto rangePtr = ptrOffset(allocPtr, rangeOffset);
+        auto rangeSize = std::min((chunk - firstChunk) * pageFaultData.migrationChunkSize, pageFaultData.size - rangeOffset);
+
+        auto start = std::chrono::steady_clock::now();
+        this->transferRangeToGpu(allocPtr, rangePtr, rangeSize, pageFaultData.cmdQ);
+        auto end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (debugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation range 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(rangePtr), rangeSize, elapsedTime / 1e3);
+        }
+
+        this->protectCPUMemoryAccess(rangePtr, rangeSize);
+    }
+}
+
+void PageFaultManager::migrateChunkToCpuDomain(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData) {
+    auto chunk = ptrDiff(faultPtr, allocPtr) / pageFaultData.migrationChunkSize;
+    auto chunkOffset = chunk * pageFaultData.migrationChunkSize;
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+    auto chunkSize = std::min(pageFaultData.migrationChunkSize, pageFaultData.size - chunkOffset);
+
+    if (!pageFaultData.cpuChunks[chunk]) {
+        auto start = std::chrono::steady_clock::now();
+        this->transferToCpu(chunkPtr, chunkSize, pageFaultData.cmdQ);
+        auto end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (debugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation range 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(chunkPtr), chunkSize, elapsedTime / 1e3);
+        }
+        pageFaultData.cpuChunks[chunk] = true;
+    }
+    this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+
+    if (pageFaultData.domain == AllocationDomain::gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+        pageFaultData.domain = AllocationDomain::cpu;
+    }
+    this->setCpuAllocEvictable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    this->allowCPUMemoryEviction(allocPtr, pageFaultData);
+}
+
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    --alloc;
+
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.migrationChunkSize != 0u && pageFaultData.domain != AllocationDomain::none) {
+        this->migrateChunkToCpuDomain(allocPtr, ptr, pageFaultData);
+        return true;
+    }
+
+    gpuDomainHandler(this, allocPtr, pageFaultData);
+    if (pageFaultData.migrationChunkSize != 0u && pageFaultData.domain == AllocationDomain::cpu) {
+        std::fill(pageFaultData.cpuChunks.begin(), pageFaultData.cpuChunks.end(), true);
     }
-    return false;
+    return true;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
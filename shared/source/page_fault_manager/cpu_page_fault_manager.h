@@ -10,8 +10,9 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -43,6 +44,8 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t migrationChunkSize = 0u;
+        std::vector<bool> cpuChunks;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -52,6 +55,8 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToGpu(void *allocPtr, void *rangePtr, size_t rangeSize, void *cmdQ);
+    MOCKABLE_VIRTUAL bool isRangeMigrationSupported();
 
   protected:
     virtual bool checkFaultHandlerFromPageFaultManager() = 0;
@@ -70,10 +75,13 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateChunkToCpuDomain(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData);
+    void migrateChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData);
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    // ordered by base address, so the allocation containing a faulting address is found with a single lookup
+    std::map<void *, PageFaultData> memoryData;
     SpinLock mtx;
 };
 } // namespace NEO
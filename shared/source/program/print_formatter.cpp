@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/string.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace NEO {
@@ -24,6 +25,20 @@ PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t print
     output.reset(new char[maxSinglePrintStringLength]);
 }
 
+void PrintFormatter::printKernelOutput() {
+    std::string pendingOutput;
+    printKernelOutput([&pendingOutput](char *str) {
+        pendingOutput += str;
+        if (pendingOutput.size() >= stdoutFlushThreshold) {
+            printToStdout(pendingOutput.c_str());
+            pendingOutput.clear();
+        }
+    });
+    if (!pendingOutput.empty()) {
+        printToStdout(pendingOutput.c_str());
+    }
+}
+
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
     currentOffset = initialOffset;
 
@@ -56,40 +71,67 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
 }
 
 void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
-    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
-
+    constexpr size_t maxCursor = maxSinglePrintStringLength - 1;
     size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
 
-    for (size_t i = 0; i <= length; i++) {
-        if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
-        else if (formatString[i] == '%') {
-            size_t end = i;
-            if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+    for (const auto &token : getParsedFormat(formatString)) {
+        if (!token.isConversion) {
+            auto count = std::min(token.text.size(), maxCursor - cursor);
+            memcpy_s(output.get() + cursor, maxSinglePrintStringLength - cursor, token.text.c_str(), count);
+            cursor += count;
+        } else if (token.isString) {
+            cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, token.text.c_str());
+        } else {
+            cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, token.text.c_str());
+        }
+        cursor = std::min(cursor, maxCursor);
+    }
+    output[cursor] = '\0';
+    print(output.get());
+}
+
+const PrintFormatter::ParsedFormat &PrintFormatter::getParsedFormat(const char *formatString) {
+    auto parsedFormat = parsedFormats.find(formatString);
+    if (parsedFormat != parsedFormats.end()) {
+        return parsedFormat->second;
+    }
+
+    auto &tokens = parsedFormats[formatString];
+    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+    std::string literal;
+
+    for (size_t i = 0; i < length; i++) {
+        if (formatString[i] == '\\') {
+            if (++i == length) {
+                break;
+            }
+            literal += escapeChar(formatString[i]);
+        } else if (formatString[i] == '%') {
+            if (i + 1 < length && formatString[i + 1] == '%') {
+                literal += '%';
                 i++;
                 continue;
             }
 
+            size_t end = i;
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
 
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
-
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-            else
-                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
+            if (!literal.empty()) {
+                tokens.push_back({std::move(literal), false, false});
+                literal.clear();
+            }
+            tokens.push_back({std::string(formatString + i, end - i), true, formatString[end - 1] == 's'});
 
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            literal += formatString[i];
         }
     }
-    output[maxSinglePrintStringLength - 1] = '\0';
-    print(output.get());
+    if (!literal.empty()) {
+        tokens.push_back({std::move(literal), false, false});
+    }
+    return tokens;
 }
 
 void PrintFormatter::stripVectorFormat(const char *format, char *stripped) {
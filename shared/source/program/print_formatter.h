@@ -17,6 +17,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count); // NOLINT(readability-identifier-naming)
 
@@ -47,13 +48,23 @@ class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
                    bool using32BitPointers, const StringMap *stringLiteralMap = nullptr);
-    void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToStdout(str); });
+    void printKernelOutput();
+    void printKernelOutput(const std::function<void(char *)> &print);
     void setInitialOffset(uint32_t offset) {
         initialOffset = offset;
     }
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
+    constexpr static size_t stdoutFlushThreshold = 64 * MemoryConstants::kiloByte;
 
   protected:
+    struct FormatToken {
+        std::string text;
+        bool isConversion = false;
+        bool isString = false;
+    };
+    using ParsedFormat = std::vector<FormatToken>;
+
+    const ParsedFormat &getParsedFormat(const char *formatString);
     const char *queryPrintfString(uint32_t index) const;
     void printString(const char *formatString, const std::function<void(char *)> &print);
     size_t printToken(char *output, size_t size, const char *formatString);
@@ -125,6 +136,7 @@ class PrintFormatter {
     }
 
     std::unique_ptr<char[]> output;
+    std::unordered_map<const char *, ParsedFormat> parsedFormats; // format strings split into literals and conversions, reused for repeated prints
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
@@ -81,9 +81,11 @@ class AbstractBuffersAllocator : public SmallBuffersParams<BuffersPoolType> {
     using Params::startingOffset;
     static_assert(aggregatedSmallBuffersPoolSize > smallBufferThreshold, "Largest allowed buffer needs to fit in pool");
 
-    void releasePools() { this->bufferPools.clear(); }
-    bool isPoolBuffer(const BufferParentType *buffer) const;
-    void tryFreeFromPoolBuffer(BufferParentType *possiblePoolBuffer, size_t offset, size_t size);
+    virtual ~AbstractBuffersAllocator() = default;
+
+    virtual void releasePools() { this->bufferPools.clear(); }
+    virtual bool isPoolBuffer(const BufferParentType *buffer) const;
+    virtual void tryFreeFromPoolBuffer(BufferParentType *possiblePoolBuffer, size_t offset, size_t size);
 
   protected:
     inline bool isSizeWithinThreshold(size_t size) const { return smallBufferThreshold >= size; }
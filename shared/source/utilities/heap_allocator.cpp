@@ -109,6 +109,39 @@ double HeapAllocator::getUsage() const {
     return static_cast<double>(size - availableSize) / size;
 }
 
+HeapStatistics HeapAllocator::getStatistics() {
+    static constexpr std::array<uint64_t, HeapStatistics::numFreeChunkSizeClasses - 1> sizeClassLimits = {
+        MemoryConstants::pageSize64k, MemoryConstants::pageSize2M, 64 * MemoryConstants::megaByte, MemoryConstants::gigaByte};
+
+    HeapStatistics statistics{};
+    auto addFreeChunk = [&statistics](uint64_t chunkSize) {
+        if (chunkSize == 0u) {
+            return;
+        }
+        size_t sizeClass = 0u;
+        for (auto classLimit : sizeClassLimits) {
+            if (chunkSize < classLimit) {
+                break;
+            }
+            sizeClass++;
+        }
+        statistics.freeChunksHistogram[sizeClass]++;
+        statistics.freeChunksCount++;
+        statistics.largestFreeChunk = std::max(statistics.largestFreeChunk, chunkSize);
+    };
+
+    std::lock_guard<std::mutex> lock(mtx);
+    statistics.freeSize = availableSize;
+    addFreeChunk(pRightBound - pLeftBound);
+    for (auto &chunk : freedChunksSmall) {
+        addFreeChunk(chunk.size);
+    }
+    for (auto &chunk : freedChunksBig) {
+        addFreeChunk(chunk.size);
+    }
+    return statistics;
+}
+
 uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
     size_t elements = freedChunks.size();
     size_t bestFitIndex = -1;
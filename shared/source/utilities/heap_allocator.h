@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/constants.h"
 
+#include <array>
 #include <cstdint>
 #include <mutex>
 #include <vector>
@@ -23,6 +24,16 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+struct HeapStatistics {
+    // free chunks are bucketed by size: <64KB, <2MB, <64MB, <1GB, >=1GB
+    static constexpr size_t numFreeChunkSizeClasses = 5u;
+
+    uint64_t freeSize = 0u;
+    uint64_t largestFreeChunk = 0u;
+    uint32_t freeChunksCount = 0u;
+    std::array<uint32_t, numFreeChunkSizeClasses> freeChunksHistogram{};
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
@@ -58,6 +69,8 @@ class HeapAllocator {
 
     double getUsage() const;
 
+    HeapStatistics getStatistics();
+
   protected:
     const uint64_t size;
     uint64_t availableSize;
@@ -72,6 +72,10 @@ class TagNodeBase : public NonCopyableOrMovableClass {
 
     virtual void const *getContextEndAddress(uint32_t packetIndex) const = 0;
 
+    // Walk all used packets at once instead of querying them one by one
+    virtual void updateGlobalBoundaryValues(uint64_t &globalStart, uint64_t &globalEnd) const = 0;
+    virtual bool areAllPacketsCompleted() const = 0;
+
     virtual uint64_t &getGlobalEndRef() const = 0;
     virtual uint64_t &getContextCompleteRef() const = 0;
 
@@ -128,6 +132,9 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
 
     void const *getContextEndAddress(uint32_t packetIndex) const override;
 
+    void updateGlobalBoundaryValues(uint64_t &globalStart, uint64_t &globalEnd) const override;
+    bool areAllPacketsCompleted() const override;
+
     uint64_t &getGlobalEndRef() const override;
     uint64_t &getContextCompleteRef() const override;
 
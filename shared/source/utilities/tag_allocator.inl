@@ -224,6 +224,24 @@ void const *TagNode<TagType>::getContextEndAddress([[maybe_unused]] uint32_t pac
     }
 }
 
+template <typename TagType>
+void TagNode<TagType>::updateGlobalBoundaryValues([[maybe_unused]] uint64_t &globalStart, [[maybe_unused]] uint64_t &globalEnd) const {
+    if constexpr (TagType::getTagNodeType() == TagNodeType::timestampPacket) {
+        tagForCpuAccess->updateGlobalBoundaryValues(packetsUsed, globalStart, globalEnd);
+    } else {
+        UNRECOVERABLE_IF(true);
+    }
+}
+
+template <typename TagType>
+bool TagNode<TagType>::areAllPacketsCompleted() const {
+    if constexpr (TagType::getTagNodeType() == TagNodeType::timestampPacket) {
+        return tagForCpuAccess->areAllPacketsCompleted(packetsUsed);
+    } else {
+        UNRECOVERABLE_IF(true);
+    }
+}
+
 template <typename TagType>
 uint64_t &TagNode<TagType>::getContextCompleteRef() const {
     if constexpr (TagType::getTagNodeType() == TagNodeType::hwTimeStamps) {
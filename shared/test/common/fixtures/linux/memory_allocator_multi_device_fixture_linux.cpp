@@ -19,7 +19,7 @@ void MemoryAllocatorMultiDeviceSystemSpecificFixture::setUp(ExecutionEnvironment
 
 void MemoryAllocatorMultiDeviceSystemSpecificFixture::tearDown(ExecutionEnvironment &executionEnvironment) {
     auto memoryManager = static_cast<TestedDrmMemoryManager *>(executionEnvironment.memoryManager.get());
-    auto bufferObject = memoryManager->sharingBufferObjects.back();
+    auto bufferObject = memoryManager->sharingBufferObjects.begin()->second;
     memoryManager->eraseSharedBufferObject(bufferObject);
     delete bufferObject;
 }
@@ -22,6 +22,8 @@ class TestedDrmCommandStreamReceiver : public DrmCommandStreamReceiver<GfxFamily
     using BaseClass::exec;
     using BaseClass::execObjectsStorage;
     using BaseClass::residency;
+    using BaseClass::residencyWorkingSetHits;
+    using BaseClass::residencyWorkingSetMisses;
     using BaseClass::useUserFenceWait;
     using CommandStreamReceiver::activePartitions;
     using CommandStreamReceiver::clearColorAllocation;
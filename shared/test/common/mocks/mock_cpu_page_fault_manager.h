@@ -51,6 +51,14 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangeToGpu(void *allocPtr, void *rangePtr, size_t rangeSize, void *cmdQ) override {
+        transferRangeToGpuCalled++;
+        transferRangeToGpuAddress = rangePtr;
+        transferRangeToGpuSize = rangeSize;
+    }
+    bool isRangeMigrationSupported() override {
+        return rangeMigrationSupported;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -102,19 +110,23 @@ class MockPageFaultManager : public PageFaultManager {
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferRangeToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
     int setCpuAllocEvictableCalled = 0;
     int allowCPUMemoryEvictionCalled = 0;
     int allowCPUMemoryEvictionImplCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
+    void *transferRangeToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferRangeToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
     bool isCpuAllocEvictable = true;
+    bool rangeMigrationSupported = false;
     aub_stream::EngineType engineType = aub_stream::EngineType::NUM_ENGINES;
     EngineUsage engineUsage = EngineUsage::engineUsageCount;
 };
@@ -14,6 +14,7 @@ using namespace NEO;
 class MockGfxPartition : public GfxPartition {
   public:
     using GfxPartition::osMemory;
+    using GfxPartition::printHeapStatistics;
 
     MockGfxPartition() : GfxPartition(reservedCpuAddressRange) {}
     MockGfxPartition(OSMemory::ReservedCpuAddressRange &sharedReservedCpuAddressRange) : GfxPartition(sharedReservedCpuAddressRange) {}
@@ -75,6 +75,8 @@ bool mmapAllowExtendedPointers = false;
 bool failMmap = false;
 uint32_t mmapFuncCalled = 0u;
 uint32_t munmapFuncCalled = 0u;
+uint32_t madviseFuncCalled = 0u;
+int madviseLastAdvice = 0;
 
 int (*sysCallsOpen)(const char *pathname, int flags) = nullptr;
 int (*sysCallsClose)(int fileDescriptor) = nullptr;
@@ -338,6 +340,12 @@ int munmap(void *addr, size_t size) noexcept {
     return 0;
 }
 
+int madvise(void *addr, size_t size, int advice) noexcept {
+    madviseFuncCalled++;
+    madviseLastAdvice = advice;
+    return 0;
+}
+
 ssize_t read(int fd, void *buf, size_t count) {
     if (sysCallsRead != nullptr) {
         return sysCallsRead(fd, buf, count);
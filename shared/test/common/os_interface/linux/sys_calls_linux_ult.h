@@ -80,6 +80,8 @@ extern bool mmapCaptureExtendedPointers;
 extern bool mmapAllowExtendedPointers;
 extern uint32_t mmapFuncCalled;
 extern uint32_t munmapFuncCalled;
+extern uint32_t madviseFuncCalled;
+extern int madviseLastAdvice;
 
 extern off_t lseekReturn;
 extern std::atomic<int> lseekCalledCount;
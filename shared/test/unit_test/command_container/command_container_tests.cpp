@@ -17,6 +17,7 @@
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_bindless_heaps_helper.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -303,6 +304,49 @@ TEST_F(CommandContainerTest, givenCmdContainerWithAllocsListWhenAllocateAndReset
     allocList.freeAllGraphicsAllocations(pDevice);
 }
 
+TEST_F(CommandContainerTest, givenReusableCommandBufferPoolMaxSizeWhenCmdContainerIsDestroyedThenAllocationsAboveLimitAreReleased) {
+    DebugManagerStateRestore restore;
+
+    AllocationsList allocList;
+    auto cmdContainer = std::make_unique<CommandContainer>();
+    cmdContainer->initialize(pDevice, &allocList, HeapSize::defaultHeapSize, true, false);
+    cmdContainer->allocateNextCommandBuffer();
+    cmdContainer->allocateNextCommandBuffer();
+    auto &cmdBufferAllocs = cmdContainer->getCmdBufferAllocations();
+    EXPECT_EQ(3u, cmdBufferAllocs.size());
+    auto cmdBufferSize = cmdBufferAllocs[0]->getUnderlyingBufferSize();
+
+    debugManager.flags.ReusableCommandBufferPoolMaxSize.set(static_cast<int32_t>(cmdBufferSize / MemoryConstants::kiloByte));
+    cmdContainer.reset();
+
+    ASSERT_FALSE(allocList.peekIsEmpty());
+    EXPECT_EQ(allocList.peekHead(), allocList.peekTail());
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
+TEST_F(CommandContainerTest, givenAllocationsListWhenTrimmingToSizeThenLeastRecentlyStoredAllocationsAreReleased) {
+    AllocationsList allocList;
+    auto memoryManager = pDevice->getMemoryManager();
+    auto allocation0 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocationSize = allocation0->getUnderlyingBufferSize();
+
+    allocList.pushFrontOne(*allocation0);
+    allocList.pushFrontOne(*allocation1);
+    allocList.pushFrontOne(*allocation2);
+
+    EXPECT_EQ(0u, allocList.trimToSize(3 * allocationSize, memoryManager));
+    EXPECT_TRUE(allocList.peekContains(*allocation0));
+
+    EXPECT_EQ(2 * allocationSize, allocList.trimToSize(allocationSize, memoryManager));
+    EXPECT_EQ(allocation2, allocList.peekHead());
+    EXPECT_EQ(allocation2, allocList.peekTail());
+
+    EXPECT_EQ(allocationSize, allocList.trimToSize(0u, memoryManager));
+    EXPECT_TRUE(allocList.peekIsEmpty());
+}
+
 TEST_F(CommandContainerTest, givenReusableAllocationsAndRemoveUserFenceInCmdlistResetAndDestroyFlagWhenAllocateAndResetThenHandleFenceCompletionIsCalled) {
     DebugManagerStateRestore restore;
     debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.set(0);
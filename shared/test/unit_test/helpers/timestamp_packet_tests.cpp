@@ -19,6 +19,7 @@
 #include "shared/test/common/mocks/mock_timestamp_packet.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <limits>
 #include <memory>
 
 using namespace NEO;
@@ -211,6 +212,43 @@ TEST_F(TimestampPacketTests, whenObjectIsCreatedThenInitializeAllStamps) {
     }
 }
 
+TEST_F(TimestampPacketTests, givenTagNodeWithMultiplePacketsUsedWhenUpdatingGlobalBoundaryValuesThenOnlyUsedPacketsAreTaken) {
+    TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount> tag;
+    MockTagNode mockNode;
+    mockNode.tagForCpuAccess = &tag;
+    mockNode.setPacketsUsed(2);
+
+    uint32_t packet0[4] = {10, 20, 30, 40};
+    uint32_t packet1[4] = {5, 15, 25, 50};
+    uint32_t packet2[4] = {1, 2, 3, 100};
+    tag.assignDataToAllTimestamps(0, packet0);
+    tag.assignDataToAllTimestamps(1, packet1);
+    tag.assignDataToAllTimestamps(2, packet2);
+
+    uint64_t globalStart = std::numeric_limits<uint64_t>::max();
+    uint64_t globalEnd = 0;
+    mockNode.updateGlobalBoundaryValues(globalStart, globalEnd);
+
+    EXPECT_EQ(15u, globalStart);
+    EXPECT_EQ(50u, globalEnd);
+}
+
+TEST_F(TimestampPacketTests, givenTagNodeWithMultiplePacketsUsedWhenCheckingCompletionThenAllUsedPacketsAreChecked) {
+    TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount> tag;
+    MockTagNode mockNode;
+    mockNode.tagForCpuAccess = &tag;
+    mockNode.setPacketsUsed(2);
+
+    EXPECT_FALSE(mockNode.areAllPacketsCompleted());
+
+    uint32_t completedPacket[4] = {0, 0, 0, 0};
+    tag.assignDataToAllTimestamps(0, completedPacket);
+    EXPECT_FALSE(mockNode.areAllPacketsCompleted());
+
+    tag.assignDataToAllTimestamps(1, completedPacket);
+    EXPECT_TRUE(mockNode.areAllPacketsCompleted());
+}
+
 HWTEST_F(TimestampPacketTests, whenEstimatingSizeForNodeDependencyThenReturnCorrectValue) {
     TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount> tag;
     MockTagNode mockNode;
@@ -10,6 +10,8 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 
@@ -956,3 +958,51 @@ TEST(GfxPartitionTest, givenHeapIndexWhenCheckingIsAnyHeap32ThenTrueIsReturnedFo
         EXPECT_FALSE(GfxPartition::isAnyHeap32(heapsOther[i]));
     }
 }
+
+TEST(GfxPartitionTest, givenExhaustedStandard64KBHeapWhenBorrowingStandardHeapVaIsEnabledThenAlignedRangeFromStandardHeapIsReturnedAndReleasedByAddress) {
+    DebugManagerStateRestore restorer;
+    MockGfxPartition gfxPartition;
+    gfxPartition.callBasefreeGpuAddressRange = true;
+
+    const uint64_t standardHeapBase = 0x100000000ull;
+    gfxPartition.initHeap(HeapIndex::heapStandard, standardHeapBase, MemoryConstants::gigaByte, MemoryConstants::pageSize);
+    gfxPartition.initHeap(HeapIndex::heapStandard64KB, 0x200000000ull, 4 * MemoryConstants::pageSize64k, MemoryConstants::pageSize64k);
+    const auto initialStandardHeapStatistics = gfxPartition.getHeapStatistics(HeapIndex::heapStandard);
+
+    size_t size = 3 * MemoryConstants::pageSize64k - MemoryConstants::pageSize;
+    EXPECT_EQ(0u, gfxPartition.GfxPartition::heapAllocate(HeapIndex::heapStandard64KB, size));
+    EXPECT_EQ(0u, gfxPartition.getTotalBorrowedVaSize());
+
+    debugManager.flags.BorrowStandardHeapVa.set(1);
+    size = 3 * MemoryConstants::pageSize64k - MemoryConstants::pageSize;
+    auto gpuVa = gfxPartition.GfxPartition::heapAllocate(HeapIndex::heapStandard64KB, size);
+    EXPECT_NE(0u, gpuVa);
+    EXPECT_TRUE(isAligned(gpuVa, MemoryConstants::pageSize64k));
+    EXPECT_EQ(3 * MemoryConstants::pageSize64k, size);
+    EXPECT_GT(gpuVa, gfxPartition.getHeapBase(HeapIndex::heapStandard));
+    EXPECT_LT(gpuVa + size, gfxPartition.getHeapLimit(HeapIndex::heapStandard));
+    EXPECT_EQ(size, gfxPartition.getTotalBorrowedVaSize());
+    EXPECT_EQ(initialStandardHeapStatistics.freeSize - size, gfxPartition.getHeapStatistics(HeapIndex::heapStandard).freeSize);
+
+    gfxPartition.freeGpuAddressRange(gpuVa, size);
+    EXPECT_EQ(initialStandardHeapStatistics.freeSize, gfxPartition.getHeapStatistics(HeapIndex::heapStandard).freeSize);
+    EXPECT_EQ(size, gfxPartition.getTotalBorrowedVaSize());
+}
+
+TEST(GfxPartitionTest, givenPrintGfxPartitionHeapStatisticsFlagWhenPrintingHeapStatisticsThenStatisticsArePrintedOnlyWhenFlagIsSet) {
+    DebugManagerStateRestore restorer;
+    MockGfxPartition gfxPartition;
+    gfxPartition.initHeap(HeapIndex::heapStandard, 0x100000000ull, MemoryConstants::gigaByte, MemoryConstants::pageSize);
+
+    testing::internal::CaptureStdout();
+    gfxPartition.printHeapStatistics();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+    debugManager.flags.PrintGfxPartitionHeapStatistics.set(true);
+    testing::internal::CaptureStdout();
+    gfxPartition.printHeapStatistics();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("GfxPartition heap"));
+    EXPECT_NE(std::string::npos, output.find("GfxPartition total VA borrowed from standard heap: 0"));
+    debugManager.flags.PrintGfxPartitionHeapStatistics.set(false);
+}
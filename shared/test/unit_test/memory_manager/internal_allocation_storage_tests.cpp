@@ -326,3 +326,67 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST_F(InternalAllocationStorageTest, givenHostPtrAllocationCacheEnabledWhenCompletedHostPtrAllocationIsCleanedThenItIsCachedAndCanBeObtainedForSamePtr) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.HostPtrAllocationCacheSize.set(8);
+    memoryManager->isHostPtrAllocationCacheSupportedResult = true;
+
+    auto hostPtrAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::externalHostPtr, mockDeviceBitfield});
+    auto bufferAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto hostPtr = hostPtrAllocation->getUnderlyingBuffer();
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(hostPtrAllocation), TEMPORARY_ALLOCATION, 2u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bufferAllocation), TEMPORARY_ALLOCATION, 2u);
+    storage->cleanAllocationList(2u, TEMPORARY_ALLOCATION);
+
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_TRUE(storage->getHostPtrAllocationCache().peekContains(*hostPtrAllocation));
+    EXPECT_EQ(hostPtrAllocation, storage->getHostPtrAllocationCache().peekTail());
+
+    auto otherPtrAllocation = storage->obtainTemporaryAllocationWithPtr(MemoryConstants::pageSize, ptrOffset(hostPtr, MemoryConstants::pageSize), AllocationType::externalHostPtr);
+    EXPECT_EQ(nullptr, otherPtrAllocation);
+    EXPECT_EQ(1u, storage->hostPtrAllocationCacheMisses);
+
+    auto cachedAllocation = storage->obtainTemporaryAllocationWithPtr(MemoryConstants::pageSize, hostPtr, AllocationType::externalHostPtr);
+    EXPECT_EQ(hostPtrAllocation, cachedAllocation.get());
+    EXPECT_EQ(1u, storage->hostPtrAllocationCacheHits);
+    EXPECT_TRUE(storage->getHostPtrAllocationCache().peekIsEmpty());
+
+    storage->storeAllocationWithTaskCount(std::move(cachedAllocation), TEMPORARY_ALLOCATION, 3u);
+    storage->cleanAllocationList(3u, TEMPORARY_ALLOCATION);
+    EXPECT_FALSE(storage->getHostPtrAllocationCache().peekIsEmpty());
+
+    storage->releaseHostPtrAllocationCache();
+    EXPECT_TRUE(storage->getHostPtrAllocationCache().peekIsEmpty());
+}
+
+TEST_F(InternalAllocationStorageTest, givenHostPtrAllocationCacheSizeLimitWhenCachedAllocationsExceedItThenLeastRecentlyUsedOnesAreReleased) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.HostPtrAllocationCacheSize.set(static_cast<int32_t>(MemoryConstants::pageSize / MemoryConstants::kiloByte));
+    memoryManager->isHostPtrAllocationCacheSupportedResult = true;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::externalHostPtr, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::externalHostPtr, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION, 1u);
+    storage->cleanAllocationList(1u, TEMPORARY_ALLOCATION);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), TEMPORARY_ALLOCATION, 2u);
+    storage->cleanAllocationList(2u, TEMPORARY_ALLOCATION);
+
+    EXPECT_EQ(allocation2, storage->getHostPtrAllocationCache().peekHead());
+    EXPECT_EQ(allocation2, storage->getHostPtrAllocationCache().peekTail());
+}
+
+TEST_F(InternalAllocationStorageTest, givenHostPtrAllocationCacheNotSupportedByMemoryManagerWhenCompletedHostPtrAllocationIsCleanedThenItIsReleased) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.HostPtrAllocationCacheSize.set(8);
+    memoryManager->isHostPtrAllocationCacheSupportedResult = false;
+
+    auto hostPtrAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::externalHostPtr, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(hostPtrAllocation), TEMPORARY_ALLOCATION, 2u);
+    storage->cleanAllocationList(2u, TEMPORARY_ALLOCATION);
+
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_TRUE(storage->getHostPtrAllocationCache().peekIsEmpty());
+}
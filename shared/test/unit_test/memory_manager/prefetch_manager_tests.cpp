@@ -86,3 +86,35 @@ TEST(PrefetchManagerTests, givenPrefetchManagerWhenCallingMigrateAllocationsToGp
     EXPECT_TRUE(prefetchManager->migrateAllocationsToGpuCalled);
     EXPECT_FALSE(svmManager->prefetchMemoryCalled);
 }
+
+TEST(PrefetchManagerTests, givenSameAllocationInsertedTwiceWhenMigratingAllocationsToGpuThenItIsPrefetchedOnceAndStatisticsAreUpdated) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(1);
+
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    prefetchManager->insertAllocation(prefetchContext, ptr, *svmData);
+    prefetchManager->insertAllocation(prefetchContext, ptr, *svmData);
+    EXPECT_EQ(1u, prefetchContext.allocations.size());
+
+    EXPECT_EQ(0u, prefetchManager->getPrefetchedBytes());
+    prefetchManager->migrateAllocationsToGpu(prefetchContext, *svmManager.get(), *device, *csr.get());
+    EXPECT_EQ(1u, prefetchManager->getPrefetchedAllocationsCount());
+    EXPECT_EQ(svmData->size, prefetchManager->getPrefetchedBytes());
+
+    svmManager->freeSVMAlloc(ptr);
+}
@@ -204,6 +204,42 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, GivenTwoAllocationsWhenBackingS
     mm->freeGraphicsMemory(allocation2);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenResidencyWorkingSetReuseEnabledWhenProcessingSameAllocationsAgainThenBufferObjectsListIsReused) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableResidencyWorkingSetReuse.set(1);
+
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto allocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    auto allocation2 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
+
+    ResidencyContainer allocationsForResidency{allocation, allocation2};
+
+    csr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(2u, getResidencyVector<FamilyType>().size());
+    EXPECT_EQ(0u, testedCsr->residencyWorkingSetHits);
+    testedCsr->residency.clear();
+
+    csr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(1u, testedCsr->residencyWorkingSetHits);
+    ASSERT_EQ(2u, getResidencyVector<FamilyType>().size());
+    EXPECT_TRUE(isResident<FamilyType>(allocation->getBO()));
+    EXPECT_TRUE(isResident<FamilyType>(allocation2->getBO()));
+    testedCsr->residency.clear();
+
+    auto unrelatedAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    mm->freeGraphicsMemory(unrelatedAllocation);
+
+    auto missesBefore = testedCsr->residencyWorkingSetMisses;
+    csr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(1u, testedCsr->residencyWorkingSetHits);
+    EXPECT_EQ(missesBefore + 1, testedCsr->residencyWorkingSetMisses);
+    EXPECT_EQ(2u, getResidencyVector<FamilyType>().size());
+    testedCsr->residency.clear();
+
+    mm->freeGraphicsMemory(allocation);
+    mm->freeGraphicsMemory(allocation2);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenCommandStreamWithDuplicatesWhenItIsFlushedWithGemCloseWorkerInactiveModeThenCsIsNotNulled) {
     auto commandBuffer = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
@@ -163,6 +163,22 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
     delete worker;
 }
 
+TEST_F(DrmGemCloseWorkerTests, givenMultipleBufferObjectsPushedWhenWorkerIsClosedThenAllAreClosedAndCountedInStatistics) {
+    this->drmMock->gemCloseExpected = 3;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, MemoryConstants::pageSize, 1));
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 2, MemoryConstants::pageSize64k, 1));
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 3, MemoryConstants::megaByte, 1));
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    auto statistics = worker->getStatistics();
+    EXPECT_EQ(3u, statistics.closedBufferObjects);
+    EXPECT_LE(1u, statistics.closedBatches);
+    EXPECT_LE(1u, statistics.maxPendingBufferObjects);
+}
+
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
     struct MockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
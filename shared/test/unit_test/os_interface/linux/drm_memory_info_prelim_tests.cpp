@@ -445,10 +445,12 @@ struct WhiteBoxNumaLibrary : Linux::NumaLibrary {
     using Linux::NumaLibrary::procGetMemPolicyStr;
     using Linux::NumaLibrary::procNumaAvailableStr;
     using Linux::NumaLibrary::procNumaMaxNodeStr;
+    using Linux::NumaLibrary::procNumaNodeOfCpuStr;
     using OsLibraryLoadPtr = NumaLibrary::OsLibraryLoadPtr;
     using GetMemPolicyPtr = NumaLibrary::GetMemPolicyPtr;
     using NumaAvailablePtr = NumaLibrary::NumaAvailablePtr;
     using NumaMaxNodePtr = NumaLibrary::NumaMaxNodePtr;
+    using NumaNodeOfCpuPtr = NumaLibrary::NumaNodeOfCpuPtr;
     using Linux::NumaLibrary::getMemPolicyFunction;
     using Linux::NumaLibrary::osLibrary;
     using Linux::NumaLibrary::osLibraryLoadFunction;
@@ -967,3 +969,123 @@ TEST(MemoryInfo, givenMemoryInfoWithRegionsWhenCallingCreatingGemExtWithMultiple
     EXPECT_EQ(3u, createExt->memoryRegions[2].memoryInstance);
     EXPECT_EQ(size, drm->context.receivedCreateGemExt->size);
 }
+
+TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledAndDeviceNumaNodeSelectedWhenCallingCreateGemExtForHostAllocationThenOnlyDeviceNodeIsPreferred) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationMemPolicy.set(1);
+    debugManager.flags.OverrideHostAllocationMemPolicyMode.set(-1);
+    debugManager.flags.HostAllocationNumaNodeSelection.set(2);
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[0].probedSize = 8 * MemoryConstants::gigaByte;
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    regionInfo[1].probedSize = 16 * MemoryConstants::gigaByte;
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    constexpr static int numNuma = 4;
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *mode, unsigned long nodeMask[], unsigned long, void *, unsigned long) -> long {
+        if (mode) {
+            *mode = 0;
+        }
+        for (int i = 0; i < numNuma; i++) {
+            nodeMask[i] = i;
+        }
+        return 0;
+    };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return numNuma - 1; };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+
+    WhiteBoxNumaLibrary::osLibraryLoadFunction = MockOsLibraryCustom::load;
+
+    auto memoryInfo = std::make_unique<MemoryInfo>(regionInfo, *drm);
+    ASSERT_TRUE(memoryInfo->isMemPolicySupported());
+    memoryInfo->setDeviceNumaNode(2);
+    EXPECT_EQ(2, memoryInfo->getHostAllocationNumaNode());
+
+    uint32_t handle = 0;
+    MemRegionsVec memClassInstance = {regionInfo[0].region};
+    auto ret = memoryInfo->createGemExt(memClassInstance, 1024, handle, 0, {}, -1, false, 0, true);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(static_cast<uint32_t>(MemoryInfo::memPolicyModePreferred), drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    auto &nodeMask = drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value();
+    EXPECT_EQ(4u, nodeMask.size());
+    EXPECT_EQ(1ul << 2, nodeMask[0]);
+    for (auto i = 1u; i < nodeMask.size(); i++) {
+        EXPECT_EQ(0ul, nodeMask[i]);
+    }
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
+
+TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledAndNumaNodeSelectionDisabledWhenCallingCreateGemExtForHostAllocationThenMemoryPolicyOfCallingThreadIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationMemPolicy.set(1);
+    debugManager.flags.OverrideHostAllocationMemPolicyMode.set(-1);
+    debugManager.flags.HostAllocationNumaNodeSelection.set(0);
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[0].probedSize = 8 * MemoryConstants::gigaByte;
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    regionInfo[1].probedSize = 16 * MemoryConstants::gigaByte;
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    constexpr static int numNuma = 4;
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *mode, unsigned long nodeMask[], unsigned long, void *, unsigned long) -> long {
+        if (mode) {
+            *mode = 0;
+        }
+        for (int i = 0; i < numNuma; i++) {
+            nodeMask[i] = i;
+        }
+        return 0;
+    };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return numNuma - 1; };
+    WhiteBoxNumaLibrary::NumaNodeOfCpuPtr numaNodeOfCpuHandler =
+        [](int) -> int { return 3; };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaNodeOfCpuStr)] = reinterpret_cast<void *>(numaNodeOfCpuHandler);
+
+    WhiteBoxNumaLibrary::osLibraryLoadFunction = MockOsLibraryCustom::load;
+
+    auto memoryInfo = std::make_unique<MemoryInfo>(regionInfo, *drm);
+    ASSERT_TRUE(memoryInfo->isMemPolicySupported());
+    memoryInfo->setDeviceNumaNode(2);
+    EXPECT_EQ(-1, memoryInfo->getHostAllocationNumaNode());
+
+    uint32_t handle = 0;
+    MemRegionsVec memClassInstance = {regionInfo[0].region};
+    auto ret = memoryInfo->createGemExt(memClassInstance, 1024, handle, 0, {}, -1, false, 0, true);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(0u, drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    auto &nodeMask = drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value();
+    EXPECT_EQ(4u, nodeMask.size());
+    for (auto i = 0u; i < nodeMask.size(); i++) {
+        EXPECT_EQ(static_cast<unsigned long>(i), nodeMask[i]);
+    }
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
@@ -42,6 +42,7 @@
 #include <array>
 #include <fcntl.h>
 #include <memory>
+#include <sys/mman.h>
 #include <vector>
 
 namespace {
@@ -2278,6 +2279,38 @@ TEST_F(DrmMemoryManagerTest, givenTwoGraphicsAllocationsThatShareTheSameBufferOb
     memoryManager->freeGraphicsMemory(graphicsAllocation2);
 }
 
+TEST_F(DrmMemoryManagerTest, givenSharedBufferObjectsWithDifferentHandlesWhenImportingThemAgainThenBufferObjectIsFoundByHandleAndRemovedFromSharedBufferObjectsOnLastRelease) {
+    mock->ioctlExpected.primeFdToHandle = 3;
+    mock->ioctlExpected.gemClose = 2;
+    mock->ioctlExpected.gemWait = 3;
+
+    TestedDrmMemoryManager::OsHandleData osHandleData{1u};
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, AllocationType::sharedBuffer, false, {});
+    auto graphicsAllocation = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+    mock->outputHandle++;
+    auto graphicsAllocation2 = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+    auto bo = static_cast<DrmAllocation *>(graphicsAllocation)->getBO();
+    auto bo2 = static_cast<DrmAllocation *>(graphicsAllocation2)->getBO();
+    EXPECT_NE(bo, bo2);
+    EXPECT_EQ(2u, memoryManager->sharingBufferObjects.size());
+
+    mock->outputHandle--;
+    auto graphicsAllocation3 = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+    EXPECT_EQ(bo, static_cast<DrmAllocation *>(graphicsAllocation3)->getBO());
+    EXPECT_EQ(2u, memoryManager->sharingBufferObjects.size());
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    EXPECT_EQ(2u, memoryManager->sharingBufferObjects.size());
+    memoryManager->freeGraphicsMemory(graphicsAllocation3);
+    EXPECT_EQ(1u, memoryManager->sharingBufferObjects.size());
+    EXPECT_EQ(bo2, memoryManager->findAndReferenceSharedBufferObject(bo2->getHandle(), rootDeviceIndex));
+    memoryManager->unreference(bo2, false);
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation2);
+    EXPECT_EQ(0u, memoryManager->sharingBufferObjects.size());
+    EXPECT_EQ(0u, memoryManager->peekSharedBosSize());
+}
+
 TEST_F(DrmMemoryManagerTest, givenTwoGraphicsAllocationsThatDoesnShareTheSameBufferObjectWhenTheyAreMadeResidentThenTwoBoIsPassedToExec) {
     auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<DEFAULT_TEST_FAMILY_NAME> *>(device->getDefaultEngine().commandStreamReceiver);
     mock->ioctlExpected.primeFdToHandle = 2;
@@ -3842,6 +3875,45 @@ TEST(DrmMemoryManagerFreeGraphicsMemoryUnreferenceTest,
     memoryManger.freeGraphicsMemory(allocation);
 }
 
+TEST(DrmMemoryManagerFreeGraphicsMemoryUnreferenceTest,
+     givenSameHandleImportedTwiceWithNoReuseSharedAllocationWhenFreeingInAnyOrderThenOnlyFreedBufferObjectIsRemovedFromSharedBufferObjects) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    const uint32_t rootDeviceIndex = 0u;
+    executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->osInterface = std::make_unique<OSInterface>();
+    auto drm = Drm::create(nullptr, *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]);
+    executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->osInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
+    executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->memoryOperationsInterface = DrmMemoryOperationsHandler::create(*drm, 0u, false);
+    executionEnvironment.rootDeviceEnvironments[0]->initGmm();
+    TestedDrmMemoryManager memoryManger(executionEnvironment);
+
+    TestedDrmMemoryManager::OsHandleData osHandleData{1u};
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, AllocationType::sharedBuffer, false, {});
+
+    for (bool freeFirstImportFirst : {true, false}) {
+        auto allocation = static_cast<DrmAllocation *>(memoryManger.createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, false, nullptr));
+        ASSERT_NE(nullptr, allocation);
+        auto allocation2 = static_cast<DrmAllocation *>(memoryManger.createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, false, nullptr));
+        ASSERT_NE(nullptr, allocation2);
+
+        auto bo = allocation->getBO();
+        auto bo2 = allocation2->getBO();
+        ASSERT_NE(bo, bo2);
+        ASSERT_EQ(bo->getHandle(), bo2->getHandle());
+        EXPECT_EQ(2u, memoryManger.peekSharedBosSize());
+
+        auto allocationFreedFirst = freeFirstImportFirst ? allocation : allocation2;
+        auto allocationFreedLast = freeFirstImportFirst ? allocation2 : allocation;
+        auto remainingBo = allocationFreedLast->getBO();
+
+        memoryManger.freeGraphicsMemory(allocationFreedFirst);
+        ASSERT_EQ(1u, memoryManger.peekSharedBosSize());
+        EXPECT_EQ(remainingBo, memoryManger.sharingBufferObjects.begin()->second);
+
+        memoryManger.freeGraphicsMemory(allocationFreedLast);
+        EXPECT_EQ(0u, memoryManger.peekSharedBosSize());
+    }
+}
+
 TEST(DrmMemoryManagerFreeGraphicsMemoryUnreferenceTest,
      whenPrintBOCreateDestroyResultFlagIsSetAndCallToCreateSharedAllocationThenExpectedMessageIsPrinted) {
     DebugManagerStateRestore stateRestore;
@@ -4872,6 +4944,43 @@ HWTEST_F(DrmMemoryManagerTest, givenDrmAllocationWithWithAlignmentFromUserptrWhe
     EXPECT_EQ(allocation, nullptr);
 }
 
+TEST_F(DrmMemoryManagerTest, givenHugePageAdviseEnabledWhenCreatingAllocWithAlignmentFromUserptrWith2MBAlignmentThenHugePageAdviceIsApplied) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePageAdvise.set(1);
+    VariableBackup<uint32_t> madviseCalledBackup(&SysCalls::madviseFuncCalled, 0u);
+    VariableBackup<int> madviseAdviceBackup(&SysCalls::madviseLastAdvice, 0);
+    mock->ioctlExpected.total = -1;
+
+    auto size = MemoryConstants::pageSize2M;
+    allocationData.size = size;
+
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize2M, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, SysCalls::madviseFuncCalled);
+    EXPECT_EQ(MADV_HUGEPAGE, SysCalls::madviseLastAdvice);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, SysCalls::madviseFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHugePageAdviseDisabledWhenCreatingAllocWithAlignmentFromUserptrWith2MBAlignmentThenNoAdviceIsApplied) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePageAdvise.set(0);
+    VariableBackup<uint32_t> madviseCalledBackup(&SysCalls::madviseFuncCalled, 0u);
+    mock->ioctlExpected.total = -1;
+
+    auto size = MemoryConstants::pageSize2M;
+    allocationData.size = size;
+
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize2M, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0u, SysCalls::madviseFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenAllocateGraphicsMemoryWithPropertiesCalledWithDebugSurfaceTypeThenDebugSurfaceIsCreated) {
     AllocationProperties debugSurfaceProperties{0, true, MemoryConstants::pageSize, NEO::AllocationType::debugContextSaveArea, false, false, 0b1011};
     auto debugSurface = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(debugSurfaceProperties));
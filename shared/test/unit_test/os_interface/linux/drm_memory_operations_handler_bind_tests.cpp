@@ -25,6 +25,7 @@
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/linux/mock_drm_allocation.h"
 #include "shared/test/common/mocks/linux/mock_drm_memory_manager.h"
+#include "shared/test/common/mocks/linux/mock_ioctl_helper.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -700,6 +701,37 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenMakeResidentTwiceThenAllocIsBound
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchFlushFailsWhenMakeResidentWithinOsContextThenAllocationIsNotMarkedAsBound) {
+    struct MockIoctlHelperVmBindBatch : public MockIoctlHelper {
+        using MockIoctlHelper::MockIoctlHelper;
+        bool beginVmBindBatch() override { return true; }
+        int flushVmBindBatch() override { return flushVmBindBatchResult; }
+        int flushVmBindBatchResult = -1;
+    };
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    auto graphicsAllocation = static_cast<GraphicsAllocation *>(allocation);
+    auto osContext = device->getDefaultEngine().osContext;
+    auto bo = allocation->getBO();
+
+    auto ioctlHelper = new MockIoctlHelperVmBindBatch(*mock);
+    mock->ioctlHelper.reset(ioctlHelper);
+
+    EXPECT_EQ(MemoryOperationsStatus::outOfMemory, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&graphicsAllocation, 1), false));
+    for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
+        EXPECT_FALSE(bo->getBindInfo()[bo->getOsContextId(osContext)][drmIterator]);
+    }
+
+    auto vmBindCalled = mock->context.vmBindCalled;
+    ioctlHelper->flushVmBindBatchResult = 0;
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&graphicsAllocation, 1), false));
+    EXPECT_LT(vmBindCalled, mock->context.vmBindCalled);
+    for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
+        EXPECT_EQ(osContext->getDeviceBitfield().test(drmIterator), bo->getBindInfo()[bo->getOsContextId(osContext)][drmIterator]);
+    }
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, WhenVmBindAvaialableThenMemoryManagerReturnsSupportForIndirectAllocationsAsPack) {
     mock->bindAvailable = true;
     EXPECT_TRUE(memoryManager->allowIndirectAllocationsAsPack(0u));
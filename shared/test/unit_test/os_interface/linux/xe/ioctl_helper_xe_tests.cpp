@@ -1550,6 +1550,160 @@ INSTANTIATE_TEST_SUITE_P(,
                          IoctlHelperXeFenceWaitTest,
                          ::testing::Bool());
 
+TEST(IoctlHelperXeTest, givenVmBindBatchingEnabledWhenBindingInsideBatchThenBindsAreSubmittedInSingleIoctlOnFlush) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    uint64_t fenceAddress = 0x4321;
+    uint64_t fenceValue = 0x789;
+
+    for (uint32_t handle = 1; handle <= 3; handle++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = handle;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+    }
+
+    drm.vmBindInputs.clear();
+    drm.syncInputs.clear();
+    drm.waitUserFenceInputs.clear();
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_FALSE(xeIoctlHelper->beginVmBindBatch());
+
+    for (uint32_t handle = 1; handle <= 3; handle++) {
+        VmBindExtUserFenceT vmBindExtUserFence{};
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, fenceValue + handle, 0u);
+
+        VmBindParams vmBindParams{};
+        vmBindParams.handle = handle;
+        vmBindParams.start = handle * MemoryConstants::pageSize64k;
+        vmBindParams.length = MemoryConstants::pageSize64k;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    }
+    EXPECT_EQ(0u, drm.vmBindInputs.size());
+    EXPECT_EQ(0u, drm.waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch());
+    ASSERT_EQ(1u, drm.vmBindInputs.size());
+    EXPECT_EQ(3u, drm.vmBindInputs[0].num_binds);
+    ASSERT_EQ(3u, drm.vmBindOpsInputs.size());
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(i + 1, drm.vmBindOpsInputs[i].obj);
+        EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm.vmBindOpsInputs[i].op);
+    }
+
+    ASSERT_EQ(1u, drm.syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm.syncInputs[0].addr);
+    EXPECT_EQ(fenceValue + 3, drm.syncInputs[0].timeline_value);
+
+    ASSERT_EQ(1u, drm.waitUserFenceInputs.size());
+    EXPECT_EQ(fenceAddress, drm.waitUserFenceInputs[0].addr);
+    EXPECT_EQ(fenceValue + 3, drm.waitUserFenceInputs[0].value);
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch());
+}
+
+TEST(IoctlHelperXeTest, givenPendingBatchedBindWhenUnbindingThenPendingBindIsSubmittedBeforeUnbind) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = mockBindInfo.handle;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm.vmBindInputs.clear();
+    drm.syncInputs.clear();
+    drm.waitUserFenceInputs.clear();
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0u, drm.vmBindInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->vmUnbind(vmBindParams));
+    ASSERT_EQ(2u, drm.vmBindInputs.size());
+    EXPECT_EQ(1u, drm.vmBindInputs[0].num_binds);
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm.vmBindInputs[0].bind.op);
+    EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_UNMAP), drm.vmBindInputs[1].bind.op);
+    EXPECT_EQ(2u, drm.waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch());
+    EXPECT_EQ(2u, drm.vmBindInputs.size());
+}
+
+TEST(IoctlHelperXeTest, givenBindsDeferredByOtherThreadWhenBindingOutsideBatchThenDeferredBindsAreSubmittedFirst) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableVmBindBatching.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    uint64_t fenceAddress = 0x4321;
+    uint64_t fenceValue = 0x789;
+
+    for (uint32_t handle = 1; handle <= 2; handle++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = handle;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+    }
+
+    VmBindParams vmBindParams[2] = {};
+    VmBindExtUserFenceT vmBindExtUserFence[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence[i], fenceAddress, fenceValue + i, 0u);
+        vmBindParams[i].handle = i + 1;
+        vmBindParams[i].start = (i + 1) * MemoryConstants::pageSize64k;
+        vmBindParams[i].length = MemoryConstants::pageSize64k;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams[i], vmBindExtUserFence[i]);
+    }
+
+    drm.vmBindInputs.clear();
+    drm.syncInputs.clear();
+    drm.waitUserFenceInputs.clear();
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[0]));
+    EXPECT_EQ(0u, drm.vmBindInputs.size());
+
+    std::thread otherThread([&]() {
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[1]));
+    });
+    otherThread.join();
+
+    ASSERT_EQ(2u, drm.vmBindInputs.size());
+    ASSERT_EQ(2u, drm.syncInputs.size());
+    EXPECT_EQ(fenceValue, drm.syncInputs[0].timeline_value);
+    EXPECT_EQ(fenceValue + 1, drm.syncInputs[1].timeline_value);
+
+    EXPECT_EQ(0, xeIoctlHelper->flushVmBindBatch());
+    EXPECT_EQ(2u, drm.vmBindInputs.size());
+}
+
+TEST(IoctlHelperXeTest, givenVmBindBatchingDisabledWhenBeginningBatchThenBatchIsNotStarted) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    EXPECT_FALSE(xeIoctlHelper->beginVmBindBatch());
+}
+
 TEST(IoctlHelperXeTest, givenVmBindWaitUserFenceTimeoutWhenCallingVmBindThenWaitUserFenceIsCalledWithSpecificTimeout) {
     DebugManagerStateRestore restorer;
     debugManager.flags.VmBindWaitUserFenceTimeout.set(5000000000ll);
@@ -285,6 +285,10 @@ class DrmMockXe : public DrmMockCustom {
             ret = gemVmBindReturn;
             auto vmBindInput = static_cast<drm_xe_vm_bind *>(arg);
             vmBindInputs.push_back(*vmBindInput);
+            if (vmBindInput->num_binds > 1) {
+                auto bindOps = reinterpret_cast<drm_xe_vm_bind_op *>(vmBindInput->vector_of_binds);
+                vmBindOpsInputs.insert(vmBindOpsInputs.end(), bindOps, bindOps + vmBindInput->num_binds);
+            }
 
             if (vmBindInput->num_syncs == 1) {
                 auto &syncInput = reinterpret_cast<drm_xe_sync *>(vmBindInput->syncs)[0];
@@ -379,6 +383,7 @@ class DrmMockXe : public DrmMockCustom {
     uint64_t queryEngineCycles[5]{}; // 1 qword for eci and 4 qwords
     StackVec<drm_xe_wait_user_fence, 1> waitUserFenceInputs;
     StackVec<drm_xe_vm_bind, 1> vmBindInputs;
+    std::vector<drm_xe_vm_bind_op> vmBindOpsInputs;
     StackVec<drm_xe_sync, 1> syncInputs;
     StackVec<drm_xe_ext_set_property, 1> execQueueProperties;
     drm_xe_exec_queue_create latestExecQueueCreate = {};
@@ -894,3 +894,58 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetWhenPageFaultOccursOnGpuDomainAllocThenOnlyFaultingChunkIsMigratedInBothDirections) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize / MemoryConstants::kiloByte));
+    pageFaultManager->rangeMigrationSupported = true;
+
+    const size_t chunkSize = MemoryConstants::pageSize;
+    const size_t allocSize = 3 * chunkSize + 512;
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    void *lastChunk = ptrOffset(alloc, 3 * chunkSize);
+
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(chunkSize, pageFaultManager->memoryData.at(alloc).migrationChunkSize);
+    EXPECT_EQ(4u, pageFaultManager->memoryData.at(alloc).cpuChunks.size());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(alloc, pageFaultManager->transferRangeToGpuAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultManager->memoryData.at(alloc).domain);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(lastChunk, 100)));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(lastChunk, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(512u, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(lastChunk, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(512u, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(2, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(lastChunk, pageFaultManager->transferRangeToGpuAddress);
+    EXPECT_EQ(512u, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(lastChunk, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultManager->memoryData.at(alloc).domain);
+
+    pageFaultManager->removeAllocation(alloc);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetAndRangeMigrationNotSupportedWhenInsertingAllocationThenWholeAllocationIsMigrated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SharedAllocationMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize / MemoryConstants::kiloByte));
+    pageFaultManager->rangeMigrationSupported = false;
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(alloc).migrationChunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc).cpuChunks.empty());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(0, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+}
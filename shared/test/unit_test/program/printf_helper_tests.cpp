@@ -1004,6 +1004,39 @@ TEST_F(PrintFormatterTest, GivenTypeSmallerThan4BThenItIsReadAs4BValue) {
     EXPECT_STREQ(expectedOutput, output);
 }
 
+TEST_F(PrintFormatterTest, GivenFormatStringPrintedMultipleTimesWhenPrintingThenFormatIsParsedOnceAndAllValuesArePrinted) {
+    struct WhitePrintFormatter : PrintFormatter {
+        using PrintFormatter::parsedFormats;
+        using PrintFormatter::PrintFormatter;
+    };
+    WhitePrintFormatter whitePrintFormatter(underlyingBuffer, printfBufferSize, is32bit, &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap);
+
+    auto stringIndex = injectFormatString("value %d\\n");
+    for (int i = 0; i < 3; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    std::string actualOutput;
+    whitePrintFormatter.printKernelOutput([&actualOutput](char *str) { actualOutput += str; });
+
+    EXPECT_STREQ("value 0\nvalue 1\nvalue 2\n", actualOutput.c_str());
+    EXPECT_EQ(1u, whitePrintFormatter.parsedFormats.size());
+}
+
+TEST_F(PrintFormatterTest, GivenMultiplePrintsWhenPrintingToStdoutThenAllOutputIsWrittenInOrder) {
+    auto stringIndex = injectFormatString("%d ");
+    for (int i = 0; i < 4; i++) {
+        storeData(stringIndex);
+        injectValue(i);
+    }
+
+    testing::internal::CaptureStdout();
+    printFormatter->printKernelOutput();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("0 1 2 3 ", output.c_str());
+}
+
 TEST(printToStdoutTest, GivenStringWhenPrintingToStdoutThenOutputOccurs) {
     testing::internal::CaptureStdout();
     printToStdout("test");
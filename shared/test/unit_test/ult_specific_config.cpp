@@ -33,6 +33,11 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void PageFaultManager::transferRangeToGpu(void *allocPtr, void *rangePtr, size_t rangeSize, void *cmdQ) {
+}
+bool PageFaultManager::isRangeMigrationSupported() {
+    return false;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
 }
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) { return nullptr; }
@@ -1472,3 +1472,34 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, givenFreedChunksWhenGettingStatisticsThenLargestFreeChunkAndHistogramAreReported) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 16 * MemoryConstants::megaByte;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold);
+
+    auto statistics = heapAllocator.getStatistics();
+    EXPECT_EQ(heapSize, statistics.freeSize);
+    EXPECT_EQ(heapSize, statistics.largestFreeChunk);
+    EXPECT_EQ(1u, statistics.freeChunksCount);
+    EXPECT_EQ(1u, statistics.freeChunksHistogram[2]);
+
+    size_t smallSize = MemoryConstants::pageSize;
+    auto smallPtr = heapAllocator.allocate(smallSize);
+    heapAllocator.allocate(smallSize);
+    size_t bigSize = 4 * MemoryConstants::megaByte;
+    auto bigPtr = heapAllocator.allocate(bigSize);
+    heapAllocator.allocate(bigSize);
+    heapAllocator.free(smallPtr, smallSize);
+    heapAllocator.free(bigPtr, bigSize);
+
+    statistics = heapAllocator.getStatistics();
+    EXPECT_EQ(heapSize - bigSize - smallSize, statistics.freeSize);
+    EXPECT_EQ(heapSize - 2 * bigSize - 2 * smallSize, statistics.largestFreeChunk);
+    EXPECT_EQ(3u, statistics.freeChunksCount);
+    EXPECT_EQ(1u, statistics.freeChunksHistogram[0]);
+    EXPECT_EQ(0u, statistics.freeChunksHistogram[1]);
+    EXPECT_EQ(2u, statistics.freeChunksHistogram[2]);
+    EXPECT_EQ(0u, statistics.freeChunksHistogram[3]);
+    EXPECT_EQ(0u, statistics.freeChunksHistogram[4]);
+}